@@ -0,0 +1,327 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "nuklear_gamepad_bench.h"
+
+#define BENCH_MAX_REPETITIONS 101
+#define BENCH_MAX_RESULTS 512
+
+/** Slowdowns smaller than this, in calibration loop iterations, are timer noise rather than regressions. */
+#define BENCH_NOISE_FLOOR 0.5
+
+static int bench_warmup_ns = 20000000;
+static int bench_repetition_ns = 2000000;
+static int bench_repetitions = 15;
+
+/** Nanoseconds per iteration of the calibration loop, which normalized results are measured in. */
+static double bench_calibration = 1.0;
+
+static struct nuklear_gamepad_bench_result bench_results[BENCH_MAX_RESULTS];
+static int bench_result_count = 0;
+
+volatile unsigned int nuklear_gamepad_bench_sink;
+
+double nuklear_gamepad_bench_now(void) {
+#if defined(_WIN32)
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1e9 / (double)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+#endif
+}
+
+static int bench_compare(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_measure(struct nuklear_gamepad_bench_result* result, nuklear_gamepad_bench_fn fn, void* data);
+
+/**
+ * A chain of dependent integer operations, which the CPU can't overlap or skip.
+ */
+static void bench_calibration_loop(void* data, int iterations) {
+    unsigned int x = *(unsigned int*)data;
+    for (int i = 0; i < iterations; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+    }
+    nuklear_gamepad_bench_sink += x;
+}
+
+static void bench_calibrate(void) {
+    struct nuklear_gamepad_bench_result result;
+    unsigned int seed = 2463534242u;
+    memset(&result, 0, sizeof(result));
+    bench_measure(&result, &bench_calibration_loop, &seed);
+    bench_calibration = result.min;
+}
+
+static void bench_measure(struct nuklear_gamepad_bench_result* result, nuklear_gamepad_bench_fn fn, void* data) {
+    // Warm up the caches and branch predictors, growing the batch until it is long enough to time reliably.
+    int iterations = 1;
+    double start = nuklear_gamepad_bench_now();
+    for (;;) {
+        double batch_start = nuklear_gamepad_bench_now();
+        fn(data, iterations);
+        double elapsed = nuklear_gamepad_bench_now() - batch_start;
+        if (elapsed < bench_repetition_ns && iterations < (1 << 28)) {
+            iterations *= 2;
+        }
+        else if (nuklear_gamepad_bench_now() - start >= bench_warmup_ns) {
+            break;
+        }
+    }
+
+    double samples[BENCH_MAX_REPETITIONS];
+    for (int i = 0; i < bench_repetitions; i++) {
+        double batch_start = nuklear_gamepad_bench_now();
+        fn(data, iterations);
+        samples[i] = (nuklear_gamepad_bench_now() - batch_start) / iterations;
+    }
+
+    qsort(samples, (size_t)bench_repetitions, sizeof(double), &bench_compare);
+    result->iterations = iterations;
+    result->repetitions = bench_repetitions;
+    result->min = samples[0];
+    result->median = samples[bench_repetitions / 2];
+    result->mean = 0;
+    for (int i = 0; i < bench_repetitions; i++) {
+        result->mean += samples[i];
+    }
+    result->mean /= bench_repetitions;
+    result->stddev = 0;
+    for (int i = 0; i < bench_repetitions; i++) {
+        result->stddev += (samples[i] - result->mean) * (samples[i] - result->mean);
+    }
+    result->stddev = sqrt(result->stddev / bench_repetitions);
+    result->normalized = result->min / bench_calibration;
+}
+
+struct nuklear_gamepad_bench_result nuklear_gamepad_bench_run(const char* name, int size, nuklear_gamepad_bench_fn fn, void* data) {
+    struct nuklear_gamepad_bench_result result;
+    memset(&result, 0, sizeof(result));
+    snprintf(result.name, sizeof(result.name), "%s/%d", name, size);
+    // Calibrate right before each benchmark, so the normalized time follows the clock speed the benchmark ran at.
+    bench_calibrate();
+    bench_measure(&result, fn, data);
+
+    printf("%-40s %10.2f %10.2f %10.2f %10.2f %12d %10.3f\n", result.name, result.median, result.min, result.mean, result.stddev, result.iterations, result.normalized);
+    fflush(stdout);
+
+    if (bench_result_count < BENCH_MAX_RESULTS) {
+        bench_results[bench_result_count++] = result;
+    }
+    return result;
+}
+
+
+/**
+ * Find the normalized time a benchmark had in the baseline, or a negative value if it isn't there.
+ *
+ * The baseline is the CSV written by --csv, where the name is the first column and the normalized time the last.
+ */
+static double bench_baseline_find(FILE* baseline, const char* name) {
+    char line[256];
+    size_t length = strlen(name);
+    rewind(baseline);
+    while (fgets(line, sizeof(line), baseline) != NULL) {
+        if (strncmp(line, name, length) != 0 || line[length] != ',') {
+            continue;
+        }
+        char* last = strrchr(line, ',');
+        return atof(last + 1);
+    }
+    return -1.0;
+}
+
+/**
+ * Compare the results against the baseline.
+ *
+ * @return The amount of regressions.
+ */
+static int bench_compare_baseline(const char* path, double tolerance) {
+    FILE* baseline = fopen(path, "r");
+    if (baseline == NULL) {
+        printf("Failed to open baseline %s\n", path);
+        return 1;
+    }
+
+    int regressions = 0;
+    printf("\nBaseline %s, tolerance %.0f%%\n", path, tolerance);
+    for (int i = 0; i < bench_result_count; i++) {
+        const struct nuklear_gamepad_bench_result* result = &bench_results[i];
+        double expected = bench_baseline_find(baseline, result->name);
+        if (expected <= 0.0) {
+            printf("%-40s %10.3f %10s no baseline\n", result->name, result->normalized, "");
+            continue;
+        }
+
+        double change = (result->normalized - expected) * 100.0 / expected;
+        if (change > tolerance && result->normalized - expected > BENCH_NOISE_FLOOR) {
+            printf("%-40s %10.3f %10.3f %+8.1f%% REGRESSION\n", result->name, result->normalized, expected, change);
+            regressions++;
+        }
+        else {
+            printf("%-40s %10.3f %10.3f %+8.1f%% ok\n", result->name, result->normalized, expected, change);
+        }
+    }
+
+    fclose(baseline);
+    return regressions;
+}
+
+static int bench_write_csv(const char* path) {
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        printf("Failed to write %s\n", path);
+        return 1;
+    }
+
+    fprintf(file, "name,iterations,repetitions,median_ns,min_ns,mean_ns,stddev_ns,normalized\n");
+    for (int i = 0; i < bench_result_count; i++) {
+        const struct nuklear_gamepad_bench_result* result = &bench_results[i];
+        fprintf(file, "%s,%d,%d,%.3f,%.3f,%.3f,%.3f,%.4f\n", result->name, result->iterations, result->repetitions,
+            result->median, result->min, result->mean, result->stddev, result->normalized);
+    }
+
+    fclose(file);
+    return 0;
+}
+
+static int bench_write_json(const char* path) {
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        printf("Failed to write %s\n", path);
+        return 1;
+    }
+
+    fprintf(file, "{\n  \"calibration_ns\": %.4f,\n  \"benchmarks\": [\n", bench_calibration);
+    for (int i = 0; i < bench_result_count; i++) {
+        const struct nuklear_gamepad_bench_result* result = &bench_results[i];
+        fprintf(file, "    {\"name\": \"%s\", \"iterations\": %d, \"repetitions\": %d, \"median_ns\": %.3f, \"min_ns\": %.3f, \"mean_ns\": %.3f, \"stddev_ns\": %.3f, \"normalized\": %.4f}%s\n",
+            result->name, result->iterations, result->repetitions, result->median, result->min, result->mean,
+            result->stddev, result->normalized, (i + 1 < bench_result_count) ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+
+    fclose(file);
+    return 0;
+}
+
+static void bench_usage(const char* program) {
+    printf("Usage: %s [options]\n", program);
+    printf("  --suite NAME          Only run one suite: an NK_GAMEPAD_MAX size, \"frame\" or \"backends\"\n");
+    printf("  --repetitions N       Timed repetitions per benchmark (default 15)\n");
+    printf("  --warmup-ms N         Minimum warmup per benchmark (default 20)\n");
+    printf("  --repetition-ms N     Minimum duration of each repetition (default 2)\n");
+    printf("  --baseline FILE       Fail when a result is slower than in this CSV baseline\n");
+    printf("  --tolerance PERCENT   Allowed slowdown against the baseline (default 100)\n");
+    printf("  --csv FILE            Write the results as CSV, usable as a baseline\n");
+    printf("  --json FILE           Write the results as JSON\n");
+}
+
+int main(int argc, char* argv[]) {
+    const char* suite = NULL;
+    const char* baseline = NULL;
+    const char* csv = NULL;
+    const char* json = NULL;
+    double tolerance = 100.0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--suite") == 0 && i + 1 < argc) {
+            suite = argv[++i];
+        }
+        else if (strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc) {
+            bench_repetitions = atoi(argv[++i]);
+            if (bench_repetitions < 1 || bench_repetitions > BENCH_MAX_REPETITIONS) {
+                bench_repetitions = 15;
+            }
+        }
+        else if (strcmp(argv[i], "--warmup-ms") == 0 && i + 1 < argc) {
+            bench_warmup_ns = atoi(argv[++i]) * 1000000;
+        }
+        else if (strcmp(argv[i], "--repetition-ms") == 0 && i + 1 < argc) {
+            bench_repetition_ns = atoi(argv[++i]) * 1000000;
+        }
+        else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baseline = argv[++i];
+        }
+        else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+            tolerance = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csv = argv[++i];
+        }
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json = argv[++i];
+        }
+        else {
+            bench_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    bench_calibrate();
+
+    printf("nuklear_gamepad_bench, calibration loop %.3f ns\n", bench_calibration);
+    printf("%-40s %10s %10s %10s %10s %12s %10s\n", "benchmark/NK_GAMEPAD_MAX", "median", "min", "mean", "stddev", "iterations", "normalized");
+    printf("%-40s %10s %10s %10s %10s %12s %10s\n", "", "ns/op", "ns/op", "ns/op", "ns/op", "", "");
+
+#define NUKLEAR_GAMEPAD_BENCH_RUN_SUITE(size) \
+    if (suite == NULL || strcmp(suite, #size) == 0) { \
+        nuklear_gamepad_bench_suite_##size(); \
+    }
+    NUKLEAR_GAMEPAD_BENCH_SIZES(NUKLEAR_GAMEPAD_BENCH_RUN_SUITE)
+
+    if (suite == NULL || strcmp(suite, "frame") == 0) {
+        nuklear_gamepad_bench_frame();
+    }
+
+    if (suite == NULL || strcmp(suite, "backends") == 0) {
+        nuklear_gamepad_bench_backends();
+    }
+
+    if (bench_result_count == 0) {
+        printf("No benchmarks ran\n");
+        return 1;
+    }
+
+    int failed = 0;
+    if (csv != NULL) {
+        failed += bench_write_csv(csv);
+    }
+    if (json != NULL) {
+        failed += bench_write_json(json);
+    }
+    if (baseline != NULL) {
+        int regressions = bench_compare_baseline(baseline, tolerance);
+        if (regressions > 0) {
+            printf("%d benchmark(s) regressed\n", regressions);
+            failed++;
+        }
+    }
+
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+#ifndef NUKLEAR_GAMEPAD_BENCH_H__
+#define NUKLEAR_GAMEPAD_BENCH_H__
+
+/**
+ * The NK_GAMEPAD_MAX values that suites are built for. Keep in sync with NUKLEAR_GAMEPAD_BENCH_SIZES in CMakeLists.txt.
+ */
+#define NUKLEAR_GAMEPAD_BENCH_SIZES(X) X(1) X(4) X(16) X(64) X(256)
+
+/**
+ * A benchmark body, running the operation being measured the given amount of times.
+ */
+typedef void (*nuklear_gamepad_bench_fn)(void* data, int iterations);
+
+/**
+ * Timing statistics for one benchmark, in nanoseconds per operation.
+ *
+ * The normalized time is the fastest repetition in iterations of a fixed calibration loop, which is steadier than the
+ * median under load and lets baselines carry across machines.
+ */
+struct nuklear_gamepad_bench_result {
+    char name[96];
+    int iterations; /** Operations per repetition. */
+    int repetitions;
+    double min;
+    double median;
+    double mean;
+    double stddev;
+    double normalized;
+};
+
+/**
+ * Anything written here can't be optimized away.
+ */
+extern volatile unsigned int nuklear_gamepad_bench_sink;
+
+/**
+ * Get a monotonic timestamp in nanoseconds.
+ */
+double nuklear_gamepad_bench_now(void);
+
+/**
+ * Warm up, then time the benchmark over several repetitions and report the ns/op statistics.
+ *
+ * @param name The benchmark name, such as "is_button_down(-1)".
+ * @param size The NK_GAMEPAD_MAX the benchmark was built with.
+ * @param fn The benchmark body.
+ * @param data Passed through to the body.
+ *
+ * @return The timing statistics.
+ */
+struct nuklear_gamepad_bench_result nuklear_gamepad_bench_run(const char* name, int size, nuklear_gamepad_bench_fn fn, void* data);
+
+#define NUKLEAR_GAMEPAD_BENCH_DECLARE_SUITE(size) void nuklear_gamepad_bench_suite_##size(void);
+NUKLEAR_GAMEPAD_BENCH_SIZES(NUKLEAR_GAMEPAD_BENCH_DECLARE_SUITE)
+
+/**
+ * Full headless Nuklear frames, with and without nuklear_gamepad.
+ */
+void nuklear_gamepad_bench_frame(void);
+
+/**
+ * The backends' update, against the stubbed libraries.
+ */
+void nuklear_gamepad_bench_backends(void);
+
+#endif
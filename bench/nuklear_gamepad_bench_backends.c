@@ -0,0 +1,69 @@
+/**
+ * Per-frame cost of the SDL, GLFW, raylib and pntr backends, run against the stubbed libraries from test/stubs.
+ */
+#include <stdio.h>
+
+#define NK_PRIVATE
+#define NK_SINGLE_FILE
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#include "../test/stubs/nuklear_gamepad_stubs.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#include "../nuklear_gamepad.h"
+#include "../nuklear_gamepad_sdl.h"
+#include "../nuklear_gamepad_glfw.h"
+#include "../nuklear_gamepad_raylib.h"
+#include "../nuklear_gamepad_pntr.h"
+
+#include "nuklear_gamepad_bench.h"
+
+static unsigned int bench_backends_frame;
+
+/**
+ * All gamepads connected, with the held buttons changing every frame like a busy session.
+ */
+static void bench_backends_script(void) {
+    nk_gamepad_stub_reset();
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        nk_gamepad_stub_devices[num].connected = true;
+        nk_gamepad_stub_devices[num].name = "Stub Controller";
+    }
+}
+
+static void bench_backends_update(void* data, int iterations) {
+    struct nk_gamepads* gamepads = (struct nk_gamepads*)data;
+    for (int i = 0; i < iterations; i++) {
+        for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+            nk_gamepad_stub_devices[num].buttons = (bench_backends_frame * 2654435761u + (unsigned int)num) >> 19;
+        }
+        nk_gamepad_update(gamepads);
+        bench_backends_frame++;
+    }
+    nuklear_gamepad_bench_sink += gamepads->gamepads[0].buttons;
+}
+
+static void bench_backends_run(const char* name, struct nk_gamepad_input_source source) {
+    struct nk_gamepads gamepads;
+    bench_backends_script();
+    nk_gamepad_init_with_source(&gamepads, NULL, source);
+
+    // Count the library calls of a single frame before timing.
+    nk_gamepad_stub_reset_calls();
+    nk_gamepad_update(&gamepads);
+    unsigned long calls = nk_gamepad_stub_total_calls();
+
+    struct nuklear_gamepad_bench_result result = nuklear_gamepad_bench_run(name, NK_GAMEPAD_MAX, &bench_backends_update, &gamepads);
+    printf("%-40s %10lu calls/frame %10.2f ns/call\n", result.name, calls, calls > 0 ? result.median / (double)calls : 0.0);
+
+    nk_gamepad_free(&gamepads);
+}
+
+void nuklear_gamepad_bench_backends(void) {
+    bench_backends_run("backend(sdl)", nk_gamepad_sdl_input_soure(NULL));
+    bench_backends_run("backend(glfw)", nk_gamepad_glfw_input_soure(NULL));
+    bench_backends_run("backend(raylib)", nk_gamepad_raylib_input_soure(NULL));
+    bench_backends_run("backend(pntr)", nk_gamepad_pntr_input_soure(nk_gamepad_stub_pntr_app()));
+}
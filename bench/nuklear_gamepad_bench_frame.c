@@ -0,0 +1,367 @@
+/**
+ * Headless end-to-end frame benchmark.
+ *
+ * Runs full Nuklear frames with a UI equivalent to nuklear_gamepad_demo(), once driven by plain button arrays and once
+ * through nk_gamepad_update() and the query functions, so the difference is the gamepad layer's share of the frame.
+ * A third run shows the same gamepads as a lobby of nk_gamepad_widget() controllers instead of the demo windows.
+ * Frames are converted to vertex buffers with a dummy font, and every allocation goes through a counting allocator.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NK_PRIVATE
+#define NK_SINGLE_FILE
+#define NK_INCLUDE_FIXED_TYPES
+#define NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#include "../nuklear_gamepad.h"
+#include "../nuklear_gamepad_widget.h"
+
+#include "nuklear_gamepad_bench.h"
+
+#define BENCH_FRAME_WIDTH 800
+#define BENCH_FRAME_HEIGHT 600
+
+/**
+ * Allocation counters, shared by everything a frame context allocates.
+ */
+struct bench_frame_allocations {
+    unsigned long long count;
+    unsigned long long bytes;
+};
+
+struct bench_frame_vertex {
+    float position[2];
+    float uv[2];
+    nk_byte col[4];
+};
+
+struct bench_frame {
+    struct nk_context ctx;
+    struct nk_allocator allocator;
+    struct nk_user_font font;
+    struct nk_buffer cmds;
+    struct nk_buffer vertices;
+    struct nk_buffer elements;
+    struct nk_convert_config config;
+    struct bench_frame_allocations allocations;
+    struct nk_gamepads gamepads;
+    nk_bool use_gamepads;
+    nk_bool use_widget; /** Draw every gamepad with nk_gamepad_widget() in a single window. */
+    unsigned int buttons[NK_GAMEPAD_MAX]; /** The scripted state when not using nuklear_gamepad. */
+    unsigned int frame;
+    unsigned long long frames;
+};
+
+/**
+ * One widget of the demo layout: a spacing when button is negative, a symbol button when label is NULL.
+ */
+struct bench_frame_widget {
+    int button;
+    enum nk_symbol_type symbol;
+    const char* label;
+};
+
+/** The first BENCH_FRAME_FACE_WIDGETS widgets are laid out seven to a row, the rest five to a row. */
+#define BENCH_FRAME_FACE_WIDGETS 21
+
+static const struct bench_frame_widget bench_frame_layout[] = {
+    {-1, NK_SYMBOL_NONE, NULL},
+    {NK_GAMEPAD_BUTTON_UP, NK_SYMBOL_TRIANGLE_UP, NULL},
+    {-1, NK_SYMBOL_NONE, NULL},
+    {-1, NK_SYMBOL_NONE, NULL},
+    {-1, NK_SYMBOL_NONE, NULL},
+    {NK_GAMEPAD_BUTTON_Y, NK_SYMBOL_NONE, "Y"},
+    {-1, NK_SYMBOL_NONE, NULL},
+
+    {NK_GAMEPAD_BUTTON_LEFT, NK_SYMBOL_TRIANGLE_LEFT, NULL},
+    {-1, NK_SYMBOL_NONE, NULL},
+    {NK_GAMEPAD_BUTTON_RIGHT, NK_SYMBOL_TRIANGLE_RIGHT, NULL},
+    {-1, NK_SYMBOL_NONE, NULL},
+    {NK_GAMEPAD_BUTTON_X, NK_SYMBOL_NONE, "X"},
+    {-1, NK_SYMBOL_NONE, NULL},
+    {NK_GAMEPAD_BUTTON_B, NK_SYMBOL_NONE, "B"},
+
+    {-1, NK_SYMBOL_NONE, NULL},
+    {NK_GAMEPAD_BUTTON_DOWN, NK_SYMBOL_TRIANGLE_DOWN, NULL},
+    {-1, NK_SYMBOL_NONE, NULL},
+    {-1, NK_SYMBOL_NONE, NULL},
+    {-1, NK_SYMBOL_NONE, NULL},
+    {NK_GAMEPAD_BUTTON_A, NK_SYMBOL_NONE, "A"},
+    {-1, NK_SYMBOL_NONE, NULL},
+
+    {NK_GAMEPAD_BUTTON_BACK, NK_SYMBOL_MINUS, NULL},
+    {-1, NK_SYMBOL_NONE, NULL},
+    {NK_GAMEPAD_BUTTON_GUIDE, NK_SYMBOL_RECT_SOLID, NULL},
+    {-1, NK_SYMBOL_NONE, NULL},
+    {NK_GAMEPAD_BUTTON_START, NK_SYMBOL_PLUS, NULL},
+};
+
+static void* bench_frame_alloc(nk_handle handle, void* old, nk_size size) {
+    struct bench_frame_allocations* allocations = (struct bench_frame_allocations*)handle.ptr;
+    NK_UNUSED(old);
+    allocations->count++;
+    allocations->bytes += size;
+    return malloc(size);
+}
+
+static void bench_frame_free(nk_handle handle, void* old) {
+    NK_UNUSED(handle);
+    free(old);
+}
+
+/**
+ * A fixed width font, so text layout costs something without needing a font atlas.
+ */
+static float bench_frame_text_width(nk_handle handle, float height, const char* text, int len) {
+    NK_UNUSED(handle);
+    NK_UNUSED(text);
+    return (float)len * height * 0.5f;
+}
+
+static void bench_frame_query_glyph(nk_handle handle, float height, struct nk_user_font_glyph* glyph, nk_rune codepoint, nk_rune next_codepoint) {
+    NK_UNUSED(handle);
+    NK_UNUSED(codepoint);
+    NK_UNUSED(next_codepoint);
+    nk_zero(glyph, sizeof(struct nk_user_font_glyph));
+    glyph->width = height * 0.5f;
+    glyph->height = height;
+    glyph->xadvance = height * 0.5f;
+}
+
+/**
+ * The scripted button state: a new pseudo-random set of held buttons every 8 frames.
+ */
+static unsigned int bench_frame_script(unsigned int frame, int num) {
+    unsigned int hash = ((frame >> 3) + (unsigned int)num * 0x9E3779B9u) * 2654435761u;
+    return (hash >> 13) & (NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST) - 1);
+}
+
+static nk_bool bench_frame_source_init(struct nk_gamepads* gamepads, void* user_data) {
+    NK_UNUSED(user_data);
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        gamepads->gamepads[num].available = nk_true;
+    }
+    return nk_true;
+}
+
+static void bench_frame_source_update(struct nk_gamepads* gamepads, void* user_data) {
+    struct bench_frame* bench = (struct bench_frame*)user_data;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        gamepads->gamepads[num].buttons = bench_frame_script(bench->frame, num);
+    }
+}
+
+static nk_bool bench_frame_is_down(struct bench_frame* bench, int num, enum nk_gamepad_button button) {
+    if (bench->use_gamepads) {
+        return nk_gamepad_is_button_down(&bench->gamepads, num, button);
+    }
+    return (bench->buttons[num] & NK_GAMEPAD_BUTTON_FLAG(button)) != 0;
+}
+
+/**
+ * A lobby screen with a nk_gamepad_widget() for each gamepad, four to a row.
+ */
+static void bench_frame_widget_ui(struct bench_frame* bench) {
+    struct nk_context* ctx = &bench->ctx;
+    if (nk_begin(ctx, "lobby", nk_rect(0, 0, BENCH_FRAME_WIDTH, BENCH_FRAME_HEIGHT), NK_WINDOW_BORDER)) {
+        nk_layout_row_dynamic(ctx, 120, 4);
+        for (int i = 0; i < nk_gamepad_count(&bench->gamepads); i++) {
+            nk_gamepad_widget(ctx, &bench->gamepads, i);
+        }
+    }
+    nk_end(ctx);
+}
+
+static void bench_frame_ui(struct bench_frame* bench) {
+    struct nk_context* ctx = &bench->ctx;
+    int padding = 25;
+
+    if (bench->use_widget) {
+        bench_frame_widget_ui(bench);
+        return;
+    }
+    int count = bench->use_gamepads ? nk_gamepad_count(&bench->gamepads) : NK_GAMEPAD_MAX;
+
+    for (int i = 0; i < count; i++) {
+        if (bench->use_gamepads && nk_gamepad_is_available(&bench->gamepads, i) == nk_false) {
+            continue;
+        }
+
+        char name[2];
+        name[0] = (char)(i + 95);
+        name[1] = '\0';
+        const char* title = bench->use_gamepads ? nk_gamepad_name(&bench->gamepads, i) : "Controller";
+
+        struct nk_rect window_bounds = nk_rect(
+            (float)(padding + (padding * i * 5)), (float)(padding + (padding * i * 5)),
+            BENCH_FRAME_WIDTH / 2, BENCH_FRAME_HEIGHT / 2 - padding * 2);
+
+        if (nk_begin_titled(ctx, name, title, window_bounds,
+            NK_WINDOW_BORDER | NK_WINDOW_TITLE | NK_WINDOW_MOVABLE | NK_WINDOW_SCALABLE | NK_WINDOW_MINIMIZABLE | NK_WINDOW_NO_SCROLLBAR))
+        {
+            for (int w = 0; w < (int)(sizeof(bench_frame_layout) / sizeof(bench_frame_layout[0])); w++) {
+                const struct bench_frame_widget* widget = &bench_frame_layout[w];
+                if (w == 0) {
+                    nk_layout_row_dynamic(ctx, 0, 7);
+                }
+                else if (w == BENCH_FRAME_FACE_WIDGETS) {
+                    nk_layout_row_dynamic(ctx, 0, 5);
+                }
+
+                if (widget->button < 0) {
+                    nk_spacing(ctx, 1);
+                    continue;
+                }
+
+                if (bench_frame_is_down(bench, i, (enum nk_gamepad_button)widget->button)) {
+                    nk_widget_disable_begin(ctx);
+                }
+                else {
+                    nk_widget_disable_end(ctx);
+                }
+
+                if (widget->label != NULL) {
+                    nk_button_label(ctx, widget->label);
+                }
+                else {
+                    nk_button_symbol(ctx, widget->symbol);
+                }
+            }
+            nk_widget_disable_end(ctx);
+        }
+        nk_end(ctx);
+    }
+}
+
+static nk_bool bench_frame_init(struct bench_frame* bench, nk_bool use_gamepads, nk_bool use_widget) {
+    static const struct nk_draw_vertex_layout_element vertex_layout[] = {
+        {NK_VERTEX_POSITION, NK_FORMAT_FLOAT, NK_OFFSETOF(struct bench_frame_vertex, position)},
+        {NK_VERTEX_TEXCOORD, NK_FORMAT_FLOAT, NK_OFFSETOF(struct bench_frame_vertex, uv)},
+        {NK_VERTEX_COLOR, NK_FORMAT_R8G8B8A8, NK_OFFSETOF(struct bench_frame_vertex, col)},
+        {NK_VERTEX_LAYOUT_END}
+    };
+
+    nk_zero(bench, sizeof(struct bench_frame));
+    bench->use_gamepads = use_gamepads;
+    bench->use_widget = use_widget;
+
+    bench->allocator.userdata = nk_handle_ptr(&bench->allocations);
+    bench->allocator.alloc = &bench_frame_alloc;
+    bench->allocator.free = &bench_frame_free;
+
+    bench->font.userdata = nk_handle_ptr(NULL);
+    bench->font.height = 13.0f;
+    bench->font.width = &bench_frame_text_width;
+    bench->font.query = &bench_frame_query_glyph;
+    bench->font.texture = nk_handle_id(0);
+
+    if (!nk_init(&bench->ctx, &bench->allocator, &bench->font)) {
+        return nk_false;
+    }
+    nk_buffer_init(&bench->cmds, &bench->allocator, 4 * 1024);
+    nk_buffer_init(&bench->vertices, &bench->allocator, 64 * 1024);
+    nk_buffer_init(&bench->elements, &bench->allocator, 16 * 1024);
+
+    bench->config.vertex_layout = vertex_layout;
+    bench->config.vertex_size = sizeof(struct bench_frame_vertex);
+    bench->config.vertex_alignment = NK_ALIGNOF(struct bench_frame_vertex);
+    bench->config.circle_segment_count = 22;
+    bench->config.curve_segment_count = 22;
+    bench->config.arc_segment_count = 22;
+    bench->config.global_alpha = 1.0f;
+    bench->config.shape_AA = NK_ANTI_ALIASING_ON;
+    bench->config.line_AA = NK_ANTI_ALIASING_ON;
+
+    if (use_gamepads) {
+        struct nk_gamepad_input_source source = {
+            .user_data = bench,
+            .init = &bench_frame_source_init,
+            .update = &bench_frame_source_update,
+        };
+        nk_gamepad_init_with_source(&bench->gamepads, &bench->ctx, source);
+    }
+
+    // Only count what the frames themselves allocate.
+    bench->allocations.count = 0;
+    bench->allocations.bytes = 0;
+    return nk_true;
+}
+
+static void bench_frame_free_all(struct bench_frame* bench) {
+    if (bench->use_gamepads) {
+        nk_gamepad_free(&bench->gamepads);
+    }
+    nk_buffer_free(&bench->elements);
+    nk_buffer_free(&bench->vertices);
+    nk_buffer_free(&bench->cmds);
+    nk_free(&bench->ctx);
+}
+
+static void bench_frame_run(void* data, int iterations) {
+    struct bench_frame* bench = (struct bench_frame*)data;
+    for (int i = 0; i < iterations; i++) {
+        if (bench->use_gamepads) {
+            nk_gamepad_update(&bench->gamepads);
+        }
+        else {
+            for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+                bench->buttons[num] = bench_frame_script(bench->frame, num);
+            }
+        }
+
+        nk_input_begin(&bench->ctx);
+        nk_input_end(&bench->ctx);
+
+        bench_frame_ui(bench);
+
+        nk_buffer_clear(&bench->cmds);
+        nk_buffer_clear(&bench->vertices);
+        nk_buffer_clear(&bench->elements);
+        nk_convert(&bench->ctx, &bench->cmds, &bench->vertices, &bench->elements, &bench->config);
+        nuklear_gamepad_bench_sink += (unsigned int)bench->vertices.needed;
+        nk_clear(&bench->ctx);
+
+        bench->frame++;
+    }
+    bench->frames += (unsigned long long)iterations;
+}
+
+static void bench_frame_report(const char* name, struct bench_frame* bench) {
+    char label[96];
+    snprintf(label, sizeof(label), "%s/%d", name, NK_GAMEPAD_MAX);
+    printf("%-40s %10.3f allocs/frame %12.1f bytes/frame over %llu frames\n", label,
+        (double)bench->allocations.count / (double)bench->frames,
+        (double)bench->allocations.bytes / (double)bench->frames,
+        bench->frames);
+}
+
+void nuklear_gamepad_bench_frame(void) {
+    static struct bench_frame nuklear;
+    static struct bench_frame gamepad;
+    static struct bench_frame widget;
+
+    if (!bench_frame_init(&nuklear, nk_false, nk_false) || !bench_frame_init(&gamepad, nk_true, nk_false) || !bench_frame_init(&widget, nk_true, nk_true)) {
+        printf("nuklear_gamepad_bench_frame: Failed to initialize nuklear\n");
+        return;
+    }
+
+    struct nuklear_gamepad_bench_result without = nuklear_gamepad_bench_run("frame(nuklear)", NK_GAMEPAD_MAX, &bench_frame_run, &nuklear);
+    struct nuklear_gamepad_bench_result with = nuklear_gamepad_bench_run("frame(nuklear+gamepad)", NK_GAMEPAD_MAX, &bench_frame_run, &gamepad);
+    nuklear_gamepad_bench_run("frame(widget)", NK_GAMEPAD_MAX, &bench_frame_run, &widget);
+
+    bench_frame_report("frame(nuklear)", &nuklear);
+    bench_frame_report("frame(nuklear+gamepad)", &gamepad);
+    bench_frame_report("frame(widget)", &widget);
+    printf("%-40s %10.2f ns/frame (%.2f%% of the frame)\n", "frame(gamepad share)",
+        with.median - without.median, 100.0 * (with.median - without.median) / with.median);
+
+    bench_frame_free_all(&widget);
+    bench_frame_free_all(&gamepad);
+    bench_frame_free_all(&nuklear);
+}
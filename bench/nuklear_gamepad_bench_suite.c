@@ -0,0 +1,150 @@
+/**
+ * Benchmarks for the hot path of nuklear_gamepad.h.
+ *
+ * This file is built once per NK_GAMEPAD_MAX, with NUKLEAR_GAMEPAD_BENCH_SUITE naming the entry point. Nuklear and
+ * nuklear_gamepad are compiled privately into each copy, so they don't clash when linked together.
+ */
+#define NK_PRIVATE
+#define NK_SINGLE_FILE
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#include "../nuklear_gamepad.h"
+
+#include "nuklear_gamepad_bench.h"
+
+#ifndef NUKLEAR_GAMEPAD_BENCH_SUITE
+#error "NUKLEAR_GAMEPAD_BENCH_SUITE must name the suite entry point"
+#endif
+
+/**
+ * Publishes a fixed pattern of held buttons, one nk_gamepad_button() call at a time.
+ */
+static void bench_pattern_update(struct nk_gamepads* gamepads, void* user_data) {
+    unsigned int* frame = (unsigned int*)user_data;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
+            if (((*frame + (unsigned int)(num * 7 + i)) & 7) == 0) {
+                nk_gamepad_button(gamepads, num, (enum nk_gamepad_button)i, nk_true);
+            }
+        }
+    }
+    (*frame)++;
+}
+
+static unsigned int bench_frame;
+static struct nk_gamepads bench_idle;
+static struct nk_gamepads bench_busy;
+
+static void bench_update_none(void* data, int iterations) {
+    struct nk_gamepads* gamepads = (struct nk_gamepads*)data;
+    for (int i = 0; i < iterations; i++) {
+        nk_gamepad_update(gamepads);
+    }
+}
+
+static void bench_update_pattern(void* data, int iterations) {
+    struct nk_gamepads* gamepads = (struct nk_gamepads*)data;
+    for (int i = 0; i < iterations; i++) {
+        nk_gamepad_update(gamepads);
+    }
+    nuklear_gamepad_bench_sink += gamepads->gamepads[0].buttons;
+}
+
+#define BENCH_QUERY(function, num) \
+    static void bench_##function##_##num(void* data, int iterations) { \
+        struct nk_gamepads* gamepads = (struct nk_gamepads*)data; \
+        unsigned int sink = 0; \
+        for (int i = 0; i < iterations; i++) { \
+            sink += (unsigned int)function(gamepads, num, (enum nk_gamepad_button)(i % NK_GAMEPAD_BUTTON_LAST)); \
+        } \
+        nuklear_gamepad_bench_sink += sink; \
+    }
+
+/** The last gamepad, so per-gamepad lookups aren't flattered by the first cache line. */
+#define BENCH_LAST (NK_GAMEPAD_MAX - 1)
+#define BENCH_ANY (-1)
+
+BENCH_QUERY(nk_gamepad_is_button_down, BENCH_LAST)
+BENCH_QUERY(nk_gamepad_is_button_down, BENCH_ANY)
+BENCH_QUERY(nk_gamepad_is_button_pressed, BENCH_LAST)
+BENCH_QUERY(nk_gamepad_is_button_pressed, BENCH_ANY)
+BENCH_QUERY(nk_gamepad_is_button_released, BENCH_LAST)
+BENCH_QUERY(nk_gamepad_is_button_released, BENCH_ANY)
+
+static void bench_is_available_last(void* data, int iterations) {
+    unsigned int sink = 0;
+    for (int i = 0; i < iterations; i++) {
+        sink += (unsigned int)nk_gamepad_is_available((struct nk_gamepads*)data, BENCH_LAST);
+    }
+    nuklear_gamepad_bench_sink += sink;
+}
+
+static void bench_is_available_any(void* data, int iterations) {
+    unsigned int sink = 0;
+    for (int i = 0; i < iterations; i++) {
+        sink += (unsigned int)nk_gamepad_is_available((struct nk_gamepads*)data, BENCH_ANY);
+    }
+    nuklear_gamepad_bench_sink += sink;
+}
+
+static void bench_any_button_pressed_last(void* data, int iterations) {
+    unsigned int sink = 0;
+    int num;
+    enum nk_gamepad_button button;
+    for (int i = 0; i < iterations; i++) {
+        sink += (unsigned int)nk_gamepad_any_button_pressed((struct nk_gamepads*)data, BENCH_LAST, &num, &button);
+    }
+    nuklear_gamepad_bench_sink += sink;
+}
+
+static void bench_any_button_pressed_any(void* data, int iterations) {
+    unsigned int sink = 0;
+    int num;
+    enum nk_gamepad_button button;
+    for (int i = 0; i < iterations; i++) {
+        sink += (unsigned int)nk_gamepad_any_button_pressed((struct nk_gamepads*)data, BENCH_ANY, &num, &button);
+    }
+    nuklear_gamepad_bench_sink += sink;
+}
+
+static void bench_name(void* data, int iterations) {
+    unsigned int sink = 0;
+    for (int i = 0; i < iterations; i++) {
+        sink += (unsigned int)nk_gamepad_name((struct nk_gamepads*)data, i % NK_GAMEPAD_MAX)[0];
+    }
+    nuklear_gamepad_bench_sink += sink;
+}
+
+void NUKLEAR_GAMEPAD_BENCH_SUITE(void) {
+    // Idle: every gamepad is connected and nothing is pressed, the worst case for the "any gamepad" scans.
+    nk_gamepad_init(&bench_idle, NULL, NULL);
+    nk_gamepad_update(&bench_idle);
+
+    // Busy: a shifting pattern of held buttons, so pressed and released edges happen every update.
+    struct nk_gamepad_input_source pattern = {
+        .user_data = &bench_frame,
+        .update = &bench_pattern_update,
+    };
+    nk_gamepad_init_with_source(&bench_busy, NULL, pattern);
+    nk_gamepad_update(&bench_busy);
+
+    nuklear_gamepad_bench_run("update(none)", NK_GAMEPAD_MAX, &bench_update_none, &bench_idle);
+    nuklear_gamepad_bench_run("update(pattern)", NK_GAMEPAD_MAX, &bench_update_pattern, &bench_busy);
+
+    nuklear_gamepad_bench_run("is_button_down(last)", NK_GAMEPAD_MAX, &bench_nk_gamepad_is_button_down_BENCH_LAST, &bench_busy);
+    nuklear_gamepad_bench_run("is_button_down(-1)", NK_GAMEPAD_MAX, &bench_nk_gamepad_is_button_down_BENCH_ANY, &bench_idle);
+    nuklear_gamepad_bench_run("is_button_pressed(last)", NK_GAMEPAD_MAX, &bench_nk_gamepad_is_button_pressed_BENCH_LAST, &bench_busy);
+    nuklear_gamepad_bench_run("is_button_pressed(-1)", NK_GAMEPAD_MAX, &bench_nk_gamepad_is_button_pressed_BENCH_ANY, &bench_idle);
+    nuklear_gamepad_bench_run("is_button_released(last)", NK_GAMEPAD_MAX, &bench_nk_gamepad_is_button_released_BENCH_LAST, &bench_busy);
+    nuklear_gamepad_bench_run("is_button_released(-1)", NK_GAMEPAD_MAX, &bench_nk_gamepad_is_button_released_BENCH_ANY, &bench_idle);
+    nuklear_gamepad_bench_run("is_available(last)", NK_GAMEPAD_MAX, &bench_is_available_last, &bench_idle);
+    nuklear_gamepad_bench_run("is_available(-1)", NK_GAMEPAD_MAX, &bench_is_available_any, &bench_idle);
+    nuklear_gamepad_bench_run("any_button_pressed(last)", NK_GAMEPAD_MAX, &bench_any_button_pressed_last, &bench_idle);
+    nuklear_gamepad_bench_run("any_button_pressed(-1)", NK_GAMEPAD_MAX, &bench_any_button_pressed_any, &bench_idle);
+    nuklear_gamepad_bench_run("name", NK_GAMEPAD_MAX, &bench_name, &bench_idle);
+
+    nk_gamepad_free(&bench_busy);
+    nk_gamepad_free(&bench_idle);
+}
@@ -48,6 +48,167 @@
 #define NK_GAMEPAD_NAME_SIZE 16
 #endif  // NK_GAMEPAD_NAME_SIZE
 
+#ifndef NK_GAMEPAD_MALLOC
+/**
+ * Allocator used by the optional modules that need memory. Define both NK_GAMEPAD_MALLOC and NK_GAMEPAD_FREE to override.
+ */
+#define NK_GAMEPAD_MALLOC(size) malloc(size)
+#define NK_GAMEPAD_FREE(ptr) free(ptr)
+#endif  // NK_GAMEPAD_MALLOC
+
+#ifndef NK_GAMEPAD_TRACE_BEGIN
+/**
+ * Profiler hooks around each input source callback, given a string literal naming the zone, such as
+ * "nk_gamepad_update". Define both NK_GAMEPAD_TRACE_BEGIN and NK_GAMEPAD_TRACE_END to open and close zones in your
+ * profiler. They compile to nothing by default.
+ */
+#define NK_GAMEPAD_TRACE_BEGIN(name)
+#define NK_GAMEPAD_TRACE_END(name)
+#endif  // NK_GAMEPAD_TRACE_BEGIN
+
+#ifdef NK_GAMEPAD_TRACE
+/**
+ * Add to one of the nk_gamepad_trace counters, for this frame and in total.
+ *
+ * Input sources use this to report the gamepads they polled and the events they consumed. It compiles to nothing
+ * unless NK_GAMEPAD_TRACE is defined.
+ */
+#define NK_GAMEPAD_TRACE_COUNT(gamepads, counter, amount) \
+    ((gamepads)->trace.pending.counter += (amount), (gamepads)->trace.total_##counter += (amount))
+#else
+#define NK_GAMEPAD_TRACE_COUNT(gamepads, counter, amount) ((void)0)
+#endif  // NK_GAMEPAD_TRACE
+
+#ifdef NK_GAMEPAD_JOURNAL
+#ifndef NK_GAMEPAD_JOURNAL_SIZE
+/**
+ * How many device events the journal keeps before overwriting the oldest. Must be a power of two.
+ */
+#define NK_GAMEPAD_JOURNAL_SIZE 64
+#endif  // NK_GAMEPAD_JOURNAL_SIZE
+
+#ifndef NK_GAMEPAD_JOURNAL_SPIKE
+/**
+ * Updates that take longer than this many nanoseconds are journaled as latency spikes.
+ */
+#define NK_GAMEPAD_JOURNAL_SPIKE 2000000
+#endif  // NK_GAMEPAD_JOURNAL_SPIKE
+
+/**
+ * Write a device event to the journal. Input sources use this for connections and failures. It compiles to nothing
+ * unless NK_GAMEPAD_JOURNAL is defined.
+ */
+#define NK_GAMEPAD_JOURNAL_WRITE(gamepads, num, backend, type, detail) \
+    nk_gamepad_journal_write((gamepads), (num), (backend), (type), (detail))
+#else
+#define NK_GAMEPAD_JOURNAL_WRITE(gamepads, num, backend, type, detail) ((void)0)
+#endif  // NK_GAMEPAD_JOURNAL
+
+#ifdef NK_GAMEPAD_BUDGET
+#ifndef NK_GAMEPAD_BUDGET_DEFAULT
+/**
+ * How many nanoseconds the input source update may take before it counts as a stall, until changed with
+ * nk_gamepad_set_budget().
+ */
+#define NK_GAMEPAD_BUDGET_DEFAULT 1000000
+#endif  // NK_GAMEPAD_BUDGET_DEFAULT
+
+#ifndef NK_GAMEPAD_BUDGET_MAX_SKIP
+/**
+ * The most updates to skip polling for after repeated stalls.
+ */
+#define NK_GAMEPAD_BUDGET_MAX_SKIP 64
+#endif  // NK_GAMEPAD_BUDGET_MAX_SKIP
+#endif  // NK_GAMEPAD_BUDGET
+
+#ifdef NK_GAMEPAD_EVENTS
+#ifndef NK_GAMEPAD_EVENTS_SIZE
+/**
+ * How many button changes the event ring keeps before overwriting the oldest. Must be a power of two.
+ */
+#define NK_GAMEPAD_EVENTS_SIZE 256
+#endif  // NK_GAMEPAD_EVENTS_SIZE
+#endif  // NK_GAMEPAD_EVENTS
+
+#ifdef NK_GAMEPAD_CALLBACKS
+#ifndef NK_GAMEPAD_CALLBACKS_MAX
+/**
+ * How many button callbacks can be registered at once.
+ */
+#define NK_GAMEPAD_CALLBACKS_MAX 16
+#endif  // NK_GAMEPAD_CALLBACKS_MAX
+#endif  // NK_GAMEPAD_CALLBACKS
+
+#ifdef NK_GAMEPAD_PATTERNS
+#ifndef NK_GAMEPAD_PATTERNS_MAX
+/**
+ * How many chords and sequences can be registered at once. At most 32.
+ */
+#define NK_GAMEPAD_PATTERNS_MAX 16
+#endif  // NK_GAMEPAD_PATTERNS_MAX
+
+#ifndef NK_GAMEPAD_PATTERNS_LENGTH
+/**
+ * The most steps a sequence can have.
+ */
+#define NK_GAMEPAD_PATTERNS_LENGTH 8
+#endif  // NK_GAMEPAD_PATTERNS_LENGTH
+
+#ifndef NK_GAMEPAD_PATTERNS_STATES
+/**
+ * How many states the registered patterns can be compiled into. At most 256.
+ */
+#define NK_GAMEPAD_PATTERNS_STATES 256
+#endif  // NK_GAMEPAD_PATTERNS_STATES
+
+#ifndef NK_GAMEPAD_PATTERNS_POSITIONS
+/**
+ * How many places to be in across all registered patterns, where a chord of n buttons takes 2^n - 1 of them and
+ * each other step takes one. Must be a multiple of 32.
+ */
+#define NK_GAMEPAD_PATTERNS_POSITIONS 256
+#endif  // NK_GAMEPAD_PATTERNS_POSITIONS
+#endif  // NK_GAMEPAD_PATTERNS
+
+#ifdef NK_GAMEPAD_GESTURES
+#ifndef NK_GAMEPAD_GESTURES_DOUBLE_TAP
+/**
+ * The most nanoseconds between two presses of a button for them to count as a double tap.
+ */
+#define NK_GAMEPAD_GESTURES_DOUBLE_TAP 300000000
+#endif  // NK_GAMEPAD_GESTURES_DOUBLE_TAP
+
+#ifndef NK_GAMEPAD_GESTURES_LONG_PRESS
+/**
+ * How many nanoseconds a button has to be held down for to count as a long press.
+ */
+#define NK_GAMEPAD_GESTURES_LONG_PRESS 500000000
+#endif  // NK_GAMEPAD_GESTURES_LONG_PRESS
+
+#ifndef NK_GAMEPAD_GESTURES_REPEAT_DELAY
+/**
+ * How many nanoseconds a button has to be held down for before it starts repeating.
+ */
+#define NK_GAMEPAD_GESTURES_REPEAT_DELAY 400000000
+#endif  // NK_GAMEPAD_GESTURES_REPEAT_DELAY
+
+#ifndef NK_GAMEPAD_GESTURES_REPEAT_INTERVAL
+/**
+ * How many nanoseconds apart the repeats of a held button are.
+ */
+#define NK_GAMEPAD_GESTURES_REPEAT_INTERVAL 100000000
+#endif  // NK_GAMEPAD_GESTURES_REPEAT_INTERVAL
+#endif  // NK_GAMEPAD_GESTURES
+
+#ifdef NK_GAMEPAD_ACTIONS
+#ifndef NK_GAMEPAD_ACTIONS_MAX
+/**
+ * How many actions an action set can have.
+ */
+#define NK_GAMEPAD_ACTIONS_MAX 32
+#endif  // NK_GAMEPAD_ACTIONS_MAX
+#endif  // NK_GAMEPAD_ACTIONS
+
 /**
  * Create a flag for the specified button.
  * @internal
@@ -86,7 +247,41 @@ struct nk_gamepad_input_source {
     nk_gamepad_update_fn update;
     nk_gamepad_free_fn free;
     nk_gamepad_name_fn name;
+    nk_bool persistent; /** Keep the buttons between updates rather than clearing them, so only changes need writing. */
+};
+
+/**
+ * A monotonic time in nanoseconds.
+ *
+ * @see nk_gamepad_now()
+ */
+typedef unsigned long long nk_gamepad_time;
+
+/**
+ * A clock for the gamepad system to timestamp input with, in nanoseconds.
+ *
+ * @see nk_gamepad_set_clock()
+ */
+typedef nk_gamepad_time (*nk_gamepad_clock_fn)(void* user_data);
+
+#ifdef NK_GAMEPAD_STATS
+/**
+ * Usage statistics of a gamepad, kept by nk_gamepad_update() when NK_GAMEPAD_STATS is defined.
+ *
+ * Durations are counted in updates.
+ *
+ * @see nk_gamepad_stats()
+ */
+struct nk_gamepad_stats {
+    unsigned int presses[NK_GAMEPAD_BUTTON_LAST]; /** How many times each button was pressed. */
+    unsigned int held[NK_GAMEPAD_BUTTON_LAST]; /** How many updates each button was held down in total. */
+    unsigned int hold[NK_GAMEPAD_BUTTON_LAST]; /** How many updates each button has been held down for now, or 0. */
+    unsigned int idle; /** Updates since any button was pressed or released. */
+    unsigned int connects; /** How many times the gamepad became available after initialization. */
+    unsigned int disconnects; /** How many times the gamepad stopped being available. */
+    nk_bool was_available; /** @internal */
 };
+#endif
 
 struct nk_gamepad {
     nk_bool available;
@@ -94,12 +289,321 @@ struct nk_gamepad {
     unsigned int buttons_prev;
     char name[NK_GAMEPAD_NAME_SIZE];
     void* data;
+#ifdef NK_GAMEPAD_STATS
+    struct nk_gamepad_stats stats;
+#endif
+#ifdef NK_GAMEPAD_TIMESTAMPS
+    nk_gamepad_time pressed_at[NK_GAMEPAD_BUTTON_LAST]; /** When each button was last pressed. */
+    nk_gamepad_time released_at[NK_GAMEPAD_BUTTON_LAST]; /** When each button was last released. */
+    unsigned int was_released; /** The buttons released at least once, whose released_at is set. */
+#endif
+#ifdef NK_GAMEPAD_HISTORY
+    unsigned long long history[NK_GAMEPAD_BUTTON_LAST]; /** Whether each button was down in each of the last 64 updates, latest in bit 0. */
+#endif
+#ifdef NK_GAMEPAD_THREADSAFE
+    unsigned int staged; /** Buttons held down by nk_gamepad_button_async(). @internal */
+    unsigned int latched; /** Buttons pressed by nk_gamepad_button_async() since the last update. @internal */
+    unsigned int merged; /** Buttons merged in by the last update, to release them from persistent input sources. @internal */
+#endif
+};
+
+#ifdef NK_GAMEPAD_TRACE
+/**
+ * Counters of the work done in the gamepad layer, kept when NK_GAMEPAD_TRACE is defined.
+ *
+ * The frame counters cover the last frame, from the end of the nk_gamepad_update() before it to the end of the latest
+ * one, so events an input source handles before the update are included. The totals cover everything since the
+ * gamepads were initialized.
+ */
+struct nk_gamepad_trace {
+    unsigned int backend_calls; /** Input source callbacks made. */
+    unsigned int pads_scanned; /** Gamepads polled by the input source. */
+    unsigned int events; /** Platform events or device reports consumed by the input source. */
+    unsigned long long total_backend_calls;
+    unsigned long long total_pads_scanned;
+    unsigned long long total_events;
+    unsigned long long frames; /** Calls to nk_gamepad_update(). */
+    struct {
+        unsigned int backend_calls;
+        unsigned int pads_scanned;
+        unsigned int events;
+    } pending; /** The counters of the frame in progress, published at the end of nk_gamepad_update(). @internal */
+};
+#endif
+
+#ifdef NK_GAMEPAD_JOURNAL
+enum nk_gamepad_journal_type {
+    NK_GAMEPAD_JOURNAL_CONNECTED, /** The gamepad became available. */
+    NK_GAMEPAD_JOURNAL_DISCONNECTED, /** The gamepad was removed. */
+    NK_GAMEPAD_JOURNAL_OPEN_FAILED, /** The device was found, but couldn't be opened. The detail is the error code, if any. */
+    NK_GAMEPAD_JOURNAL_NAME_CHANGED, /** The input source reported a different name. */
+    NK_GAMEPAD_JOURNAL_LATENCY_SPIKE, /** An update took longer than NK_GAMEPAD_JOURNAL_SPIKE. The detail is in microseconds. */
+    NK_GAMEPAD_JOURNAL_STALL /** An update overran the NK_GAMEPAD_BUDGET time budget. The detail is in microseconds. */
+};
+
+/**
+ * A device event, as read from the journal with nk_gamepad_journal_next().
+ */
+struct nk_gamepad_journal_entry {
+    unsigned int sequence; /** @internal The entry index plus one, or 0 while it is being written. */
+    nk_gamepad_time time; /** When the event happened, from nk_gamepad_now(). */
+    int num; /** The gamepad number, or -1 when it isn't about a single gamepad. */
+    const char* backend; /** A string literal naming the input source that reported the event. */
+    enum nk_gamepad_journal_type type;
+    int detail; /** Depends on the event type. */
+};
+
+/**
+ * A fixed-size ring of the latest device events, kept when NK_GAMEPAD_JOURNAL is defined.
+ *
+ * Writers claim entries with an atomic counter, so input sources may write from any thread without locks or allocations.
+ */
+struct nk_gamepad_journal {
+    unsigned int head; /** How many events have been written. */
+    struct nk_gamepad_journal_entry entries[NK_GAMEPAD_JOURNAL_SIZE];
+    unsigned int name_hash[NK_GAMEPAD_MAX]; /** @internal The last name seen for each gamepad. */
+};
+#endif
+
+#ifdef NK_GAMEPAD_BUDGET
+/**
+ * The time budget of the input source update, kept when NK_GAMEPAD_BUDGET is defined.
+ *
+ * When an update takes longer than the budget, the following updates keep the last known state instead of polling
+ * the input source, for twice as many updates after each consecutive stall.
+ *
+ * @see nk_gamepad_set_budget()
+ */
+struct nk_gamepad_budget {
+    nk_gamepad_time limit; /** The budget in nanoseconds, or 0 for no budget. */
+    nk_gamepad_time last; /** How long the latest input source update took. */
+    unsigned int stalls; /** How many updates overran the budget. */
+    unsigned int skipped; /** How many updates kept the last known state instead of polling. */
+    unsigned int skip; /** Updates left to skip polling for. */
+    unsigned int backoff; /** How many updates were skipped after the latest stall. */
+};
+#endif
+
+#ifdef NK_GAMEPAD_EVENTS
+/**
+ * A change to the buttons of a gamepad, as read with nk_gamepad_event_next().
+ */
+struct nk_gamepad_event {
+    nk_gamepad_time time; /** When nk_gamepad_update() saw the change, from the gamepad system's clock. */
+    int num; /** The gamepad number. */
+    unsigned int buttons; /** The buttons that are down after the change. */
+    unsigned int changed; /** The buttons that were pressed or released. */
+};
+
+/**
+ * A fixed-size ring of the latest button changes, written by nk_gamepad_update() when NK_GAMEPAD_EVENTS is defined.
+ */
+struct nk_gamepad_events {
+    unsigned int head; /** How many events have been written. */
+    struct nk_gamepad_event entries[NK_GAMEPAD_EVENTS_SIZE];
+    unsigned int buttons[NK_GAMEPAD_MAX]; /** The buttons of each gamepad as of its latest event, or 0 while it is unavailable. @internal */
+};
+
+/**
+ * Slices the button events into fixed time steps, so a simulation running at its own rate sees every press and
+ * release exactly once, in the step it happened in.
+ *
+ * @see nk_gamepad_ticker_init()
+ */
+struct nk_gamepad_ticker {
+    struct nk_gamepads* gamepads;
+    nk_gamepad_time step; /** How long each tick is, in nanoseconds. */
+    nk_gamepad_time time; /** When the latest tick ended. */
+    unsigned int cursor; /** @internal The next event to read. */
+    unsigned int buttons[NK_GAMEPAD_MAX]; /** The buttons down at the end of the latest tick. */
+    unsigned int pressed[NK_GAMEPAD_MAX]; /** The buttons pressed during the latest tick. */
+    unsigned int released[NK_GAMEPAD_MAX]; /** The buttons released during the latest tick. */
+};
+#endif
+
+/**
+ * An independent view of the buttons, with its own previous state, for a subsystem that checks for presses at its own
+ * rate.
+ *
+ * Each consumer sees every press and release once, at its next nk_gamepad_consumer_update(), however many
+ * nk_gamepad_update() calls happened in between. With NK_GAMEPAD_EVENTS, presses that were released again before the
+ * consumer updated are seen too.
+ *
+ * @see nk_gamepad_consumer_init()
+ */
+struct nk_gamepad_consumer {
+    struct nk_gamepads* gamepads;
+    unsigned int buttons[NK_GAMEPAD_MAX]; /** The buttons down as of the latest consumer update. */
+    unsigned int pressed[NK_GAMEPAD_MAX]; /** The buttons pressed since the consumer update before. */
+    unsigned int released[NK_GAMEPAD_MAX]; /** The buttons released since the consumer update before. */
+#ifdef NK_GAMEPAD_EVENTS
+    unsigned int cursor; /** @internal The next event to read. */
+#endif
+};
+
+#ifdef NK_GAMEPAD_CALLBACKS
+/**
+ * Called by nk_gamepad_update() when a button is pressed or released.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num The gamepad number.
+ * @param button The button that changed.
+ * @param down True if the button was pressed, false if it was released.
+ * @param user_data The user data given when registering the callback.
+ */
+typedef void (*nk_gamepad_button_fn)(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, nk_bool down, void* user_data);
+
+/**
+ * A registered button callback.
+ *
+ * @internal
+ */
+struct nk_gamepad_callback {
+    nk_gamepad_button_fn callback;
+    void* user_data;
+    int num; /** The gamepad number, or -1 for all of them. */
+    unsigned int buttons; /** The buttons to call back for. */
+};
+
+/**
+ * The registered button callbacks, kept when NK_GAMEPAD_CALLBACKS is defined.
+ *
+ * @internal
+ */
+struct nk_gamepad_callbacks {
+    struct nk_gamepad_callback entries[NK_GAMEPAD_CALLBACKS_MAX];
+    unsigned int watched[NK_GAMEPAD_MAX]; /** The buttons any callback wants, for each gamepad. */
+    unsigned int buttons[NK_GAMEPAD_MAX]; /** The buttons of each gamepad as of the latest update, or 0 while it is unavailable. */
+};
+#endif
+
+#ifdef NK_GAMEPAD_PATTERNS
+/**
+ * The inputs the compiled patterns step on: a press of each button, a release of each button, then one for each timeout.
+ *
+ * @internal
+ */
+#define NK_GAMEPAD_PATTERNS_SYMBOLS (NK_GAMEPAD_BUTTON_LAST * 2 + NK_GAMEPAD_PATTERNS_MAX)
+
+/**
+ * A registered chord or sequence.
+ *
+ * @internal
+ */
+struct nk_gamepad_pattern {
+    unsigned int steps[NK_GAMEPAD_PATTERNS_LENGTH]; /** The buttons to press together for each step. */
+    int length; /** How many steps there are, or 0 for a free slot. */
+    nk_gamepad_time timeout; /** The most time allowed between presses, or 0 for no limit. */
+};
+
+/**
+ * The registered patterns, compiled into a single transition table, kept when NK_GAMEPAD_PATTERNS is defined.
+ *
+ * @internal
+ */
+struct nk_gamepad_patterns {
+    struct nk_gamepad_pattern entries[NK_GAMEPAD_PATTERNS_MAX];
+    unsigned char next[NK_GAMEPAD_PATTERNS_STATES][NK_GAMEPAD_PATTERNS_SYMBOLS]; /** The state each input leads to. */
+    unsigned int accept[NK_GAMEPAD_PATTERNS_STATES]; /** The patterns completed on entering each state. */
+    nk_gamepad_time timeouts[NK_GAMEPAD_PATTERNS_MAX]; /** The distinct timeouts, shortest first. */
+    int levels; /** How many distinct timeouts there are. */
+    unsigned char state[NK_GAMEPAD_MAX]; /** The current state of each gamepad. */
+    nk_gamepad_time pressed_at[NK_GAMEPAD_MAX]; /** When each gamepad last had a button pressed. */
+    unsigned int matched[NK_GAMEPAD_MAX]; /** The patterns each gamepad completed in the latest update. */
+};
+#endif
+
+#ifdef NK_GAMEPAD_GESTURES
+/**
+ * The double tap, long press and repeat state of every button, kept when NK_GAMEPAD_GESTURES is defined.
+ *
+ * @internal
+ */
+struct nk_gamepad_gestures {
+    nk_gamepad_time tapped_at[NK_GAMEPAD_MAX][NK_GAMEPAD_BUTTON_LAST]; /** When each button in tapped was tapped. */
+    nk_gamepad_time long_at[NK_GAMEPAD_MAX][NK_GAMEPAD_BUTTON_LAST]; /** When each button in waiting becomes a long press. */
+    nk_gamepad_time repeat_at[NK_GAMEPAD_MAX][NK_GAMEPAD_BUTTON_LAST]; /** When each held button repeats next. */
+    nk_gamepad_time next[NK_GAMEPAD_MAX]; /** The earliest deadline of each gamepad. */
+    unsigned int held[NK_GAMEPAD_MAX]; /** The buttons of each gamepad with deadlines. */
+    unsigned int tapped[NK_GAMEPAD_MAX]; /** The buttons tapped once, that a second tap would make a double tap. */
+    unsigned int waiting[NK_GAMEPAD_MAX]; /** The held buttons that haven't become long presses yet. */
+    unsigned int double_tapped[NK_GAMEPAD_MAX]; /** The buttons double tapped in the latest update. */
+    unsigned int long_pressed[NK_GAMEPAD_MAX]; /** The buttons that became long presses in the latest update. */
+    unsigned int repeated[NK_GAMEPAD_MAX]; /** The buttons pressed or repeated in the latest update. */
+};
+#endif
+
+#ifdef NK_GAMEPAD_ACTIONS
+/**
+ * Named actions and the buttons bound to them, kept when NK_GAMEPAD_ACTIONS is defined.
+ *
+ * Sets made with the same names share action numbers, so switching between them is only a matter of pointing the
+ * gamepad system at another one.
+ *
+ * @see nk_gamepad_action_set_init()
+ * @see nk_gamepad_set_action_set()
+ */
+struct nk_gamepad_action_set {
+    const char* const* names; /** The name of each action. */
+    int count; /** How many actions there are. */
+    unsigned int masks[NK_GAMEPAD_ACTIONS_MAX][NK_GAMEPAD_MAX]; /** The buttons bound to each action, for each gamepad. */
+};
+#endif
+
+#ifdef NK_GAMEPAD_ACTIVE
+/**
+ * The device last used, from nk_gamepad_last_active(), when it was the keyboard of the Nuklear context.
+ */
+#define NK_GAMEPAD_ACTIVE_KEYBOARD -2
+
+/**
+ * The device the user last touched, kept when NK_GAMEPAD_ACTIVE is defined.
+ *
+ * @internal
+ */
+struct nk_gamepad_active {
+    int num; /** The gamepad number, NK_GAMEPAD_ACTIVE_KEYBOARD, or -1 if nothing was touched yet. */
+    nk_gamepad_time time; /** When it was last touched. */
+    nk_bool changed; /** Whether the device changed in the latest update. */
 };
+#endif
 
 struct nk_gamepads {
     struct nk_gamepad gamepads[NK_GAMEPAD_MAX];
     struct nk_context* ctx;
     struct nk_gamepad_input_source input_source;
+    nk_gamepad_clock_fn clock; /** @internal The clock to timestamp input with, or NULL for nk_gamepad_now(). */
+    void* clock_user_data; /** @internal */
+#ifdef NK_GAMEPAD_TIMESTAMPS
+    nk_gamepad_time time; /** When the latest update happened. */
+#endif
+#ifdef NK_GAMEPAD_TRACE
+    struct nk_gamepad_trace trace;
+#endif
+#ifdef NK_GAMEPAD_JOURNAL
+    struct nk_gamepad_journal journal;
+#endif
+#ifdef NK_GAMEPAD_BUDGET
+    struct nk_gamepad_budget budget;
+#endif
+#ifdef NK_GAMEPAD_EVENTS
+    struct nk_gamepad_events events;
+#endif
+#ifdef NK_GAMEPAD_CALLBACKS
+    struct nk_gamepad_callbacks callbacks;
+#endif
+#ifdef NK_GAMEPAD_PATTERNS
+    struct nk_gamepad_patterns patterns;
+#endif
+#ifdef NK_GAMEPAD_GESTURES
+    struct nk_gamepad_gestures gestures;
+#endif
+#ifdef NK_GAMEPAD_ACTIVE
+    struct nk_gamepad_active active;
+#endif
+#ifdef NK_GAMEPAD_ACTIONS
+    const struct nk_gamepad_action_set* actions; /** The action set in use, or NULL. */
+#endif
 };
 
 #ifdef __cplusplus
@@ -219,6 +723,46 @@ NK_API nk_bool nk_gamepad_any_button_pressed(struct nk_gamepads* gamepads, int n
  */
 NK_API void nk_gamepad_button(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, nk_bool down);
 
+/**
+ * Replace every button of the specified gamepad at once, from a mask of NK_GAMEPAD_BUTTON_FLAG() values.
+ *
+ * Input sources that read a whole gamepad state can publish it with one store, rather than one nk_gamepad_button()
+ * call per button.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num The gamepad number.
+ * @param buttons The buttons that are down. Bits outside of the known buttons are ignored.
+ *
+ * @see NK_GAMEPAD_SET_BUTTONS()
+ */
+NK_API void nk_gamepad_set_buttons(struct nk_gamepads* gamepads, int num, unsigned int buttons);
+
+#ifdef NK_GAMEPAD_THREADSAFE
+/**
+ * Invoke a button press or release event for the specified gamepad from any thread, when NK_GAMEPAD_THREADSAFE is
+ * defined.
+ *
+ * The button is staged with atomic operations, and nk_gamepad_update() merges the staged buttons of available
+ * gamepads in after polling the input source. A press that is released again before the next update is still seen
+ * as down for one update. Any number of threads may call this at once, without a lock. With a persistent input
+ * source, a button released here is released even if the input source set it down too.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num The gamepad number.
+ * @param button The button to invoke.
+ * @param down True to indicate a button press, false to indicate a button release.
+ *
+ * @see nk_gamepad_button()
+ */
+NK_API void nk_gamepad_button_async(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, nk_bool down);
+#endif
+
+/**
+ * Replace every button of the specified gamepad, like nk_gamepad_set_buttons(), without checking the gamepad
+ * number, that it is available, or the mask. For input sources that have already made sure of those.
+ */
+#define NK_GAMEPAD_SET_BUTTONS(system, num, mask) ((system)->gamepads[(num)].buttons = (unsigned int)(mask))
+
 /**
  * Returns the amount of gamepads that could become available.
  *
@@ -251,18 +795,587 @@ NK_API const char* nk_gamepad_name(struct nk_gamepads* gamepads, int num);
  */
 NK_API struct nk_gamepad_input_source* nk_gamepad_input_source(struct nk_gamepads* gamepads);
 
-#ifdef __cplusplus
-}
-#endif
+/**
+ * Get the current time of the monotonic clock.
+ *
+ * On POSIX systems this needs clock_gettime(), so strict C99 builds should define _POSIX_C_SOURCE. Otherwise the
+ * processor time from clock() is used, which NK_GAMEPAD_BUDGET refuses to build with.
+ *
+ * @return The time in nanoseconds, from an arbitrary starting point.
+ */
+NK_API nk_gamepad_time nk_gamepad_now(void);
+
+/**
+ * Replace the clock used to timestamp input, such as to control time in tests or to follow a game clock.
+ *
+ * Set it after initializing the gamepads. Only input timestamps follow it, the profiling of input sources always uses
+ * nk_gamepad_now().
+ *
+ * @param gamepads The associated gamepad system.
+ * @param clock The clock, or NULL to go back to nk_gamepad_now().
+ * @param user_data Passed through to the clock.
+ */
+NK_API void nk_gamepad_set_clock(struct nk_gamepads* gamepads, nk_gamepad_clock_fn clock, void* user_data);
+
+#ifdef NK_GAMEPAD_JOURNAL
+/**
+ * Write a device event to the journal, overwriting the oldest one when it is full. Safe to call from any thread.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num The gamepad number, or -1.
+ * @param backend A string literal naming the input source.
+ * @param type What happened.
+ * @param detail Depends on the event type.
+ *
+ * @see NK_GAMEPAD_JOURNAL_WRITE()
+ */
+NK_API void nk_gamepad_journal_write(struct nk_gamepads* gamepads, int num, const char* backend, enum nk_gamepad_journal_type type, int detail);
+
+/**
+ * Read the next device event from the journal. Requires NK_GAMEPAD_JOURNAL.
+ *
+ * Events that were overwritten before being read are skipped.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param cursor Where reading is at. Start from 0, and keep it between calls to only see new events.
+ * @param entry Where to copy the event.
+ *
+ * @return True if an event was read, false if there are no more.
+ *
+ * @code
+ * struct nk_gamepad_journal_entry entry;
+ * while (nk_gamepad_journal_next(gamepads, &cursor, &entry)) {
+ *   printf("%s %d %s\n", entry.backend, entry.num, nk_gamepad_journal_type_name(entry.type));
+ * }
+ * @endcode
+ */
+NK_API nk_bool nk_gamepad_journal_next(struct nk_gamepads* gamepads, unsigned int* cursor, struct nk_gamepad_journal_entry* entry);
 
+/**
+ * Get a readable name for a journal event type, such as "connected".
+ */
+NK_API const char* nk_gamepad_journal_type_name(enum nk_gamepad_journal_type type);
 #endif
 
-#if defined(NK_GAMEPAD_IMPLEMENTATION) && !defined(NK_GAMEPAD_HEADER_ONLY)
-#ifndef NK_GAMEPAD_IMPLEMENTATION_ONCE
-#define NK_GAMEPAD_IMPLEMENTATION_ONCE
+#ifdef NK_GAMEPAD_BUDGET
+/**
+ * Set how long the input source update may take before it counts as a stall. Requires NK_GAMEPAD_BUDGET.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param budget The budget in nanoseconds, or 0 to always poll.
+ */
+NK_API void nk_gamepad_set_budget(struct nk_gamepads* gamepads, nk_gamepad_time budget);
+#endif
 
-// Platform detection.
-#if !defined(NK_GAMEPAD_SDL) && !defined(NK_GAMEPAD_GLFW) && !defined(NK_GAMEPAD_RAYLIB) && !defined(NK_GAMEPAD_PNTR) && !defined(NK_GAMEPAD_KEYBOARD) && !defined(NK_GAMEPAD_NONE)
+#ifdef NK_GAMEPAD_EVENTS
+/**
+ * Read the next button change from the event ring. Requires NK_GAMEPAD_EVENTS.
+ *
+ * Events are written by nk_gamepad_update(), so read them from the same thread. Events that were overwritten before
+ * being read are skipped.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param cursor Where reading is at. Keep it between calls to only see new events.
+ * @param event Where to copy the event.
+ *
+ * @return True if an event was read, false if there are no more.
+ */
+NK_API nk_bool nk_gamepad_event_next(struct nk_gamepads* gamepads, unsigned int* cursor, struct nk_gamepad_event* event);
+
+/**
+ * Start slicing the button events of a gamepad system into fixed time steps. Requires NK_GAMEPAD_EVENTS.
+ *
+ * @param ticker The ticker to initialize.
+ * @param gamepads The associated gamepad system.
+ * @param step How long each tick is, in nanoseconds. A step of 0 leaves the ticker without any ticks.
+ *
+ * @see nk_gamepad_tick()
+ */
+NK_API void nk_gamepad_ticker_init(struct nk_gamepad_ticker* ticker, struct nk_gamepads* gamepads, nk_gamepad_time step);
+
+/**
+ * Advance the ticker by one step if a whole step has passed, taking in the button events that happened up to its end.
+ *
+ * Call nk_gamepad_update() once per frame, and then tick until this returns false. Each press and release is seen in
+ * exactly one tick, however many ticks there are per frame.
+ *
+ * @param ticker The ticker to advance.
+ * @param now The current time, from nk_gamepad_now() or the clock given to nk_gamepad_set_clock().
+ *
+ * @return True if a tick was taken, false if the next one isn't due yet.
+ *
+ * @code
+ * nk_gamepad_update(&gamepads);
+ * while (nk_gamepad_tick(&ticker, nk_gamepad_now())) {
+ *   if (nk_gamepad_tick_is_button_pressed(&ticker, 0, NK_GAMEPAD_BUTTON_A)) {
+ *     jump();
+ *   }
+ *   simulate(ticker.step);
+ * }
+ * @endcode
+ */
+NK_API nk_bool nk_gamepad_tick(struct nk_gamepad_ticker* ticker, nk_gamepad_time now);
+
+/**
+ * Check whether a button was down at the end of the latest tick.
+ *
+ * @param ticker The ticker.
+ * @param num Which gamepad to check. -1 will check for any gamepad.
+ * @param button The button to check.
+ */
+NK_API nk_bool nk_gamepad_tick_is_button_down(struct nk_gamepad_ticker* ticker, int num, enum nk_gamepad_button button);
+
+/**
+ * Check whether a button was pressed during the latest tick.
+ *
+ * @param ticker The ticker.
+ * @param num Which gamepad to check. -1 will check for any gamepad.
+ * @param button The button to check.
+ */
+NK_API nk_bool nk_gamepad_tick_is_button_pressed(struct nk_gamepad_ticker* ticker, int num, enum nk_gamepad_button button);
+
+/**
+ * Check whether a button was released during the latest tick.
+ *
+ * @param ticker The ticker.
+ * @param num Which gamepad to check. -1 will check for any gamepad.
+ * @param button The button to check.
+ */
+NK_API nk_bool nk_gamepad_tick_is_button_released(struct nk_gamepad_ticker* ticker, int num, enum nk_gamepad_button button);
+#endif
+
+/**
+ * Start an independent view of the buttons, beginning from their current state.
+ *
+ * @param consumer The consumer to initialize.
+ * @param gamepads The associated gamepad system.
+ *
+ * @see nk_gamepad_consumer_update()
+ */
+NK_API void nk_gamepad_consumer_init(struct nk_gamepad_consumer* consumer, struct nk_gamepads* gamepads);
+
+/**
+ * Catch the consumer up with the buttons, working out what was pressed and released since its last update. This
+ * doesn't poll the input source, so call it as often as the subsystem needs after nk_gamepad_update().
+ *
+ * @param consumer The consumer to update.
+ *
+ * @code
+ * nk_gamepad_update(&gamepads);
+ * nk_gamepad_consumer_update(&ui_input);
+ * if (nk_gamepad_consumer_is_button_pressed(&ui_input, -1, NK_GAMEPAD_BUTTON_A)) {
+ *   confirm();
+ * }
+ * @endcode
+ */
+NK_API void nk_gamepad_consumer_update(struct nk_gamepad_consumer* consumer);
+
+/**
+ * Check whether a button was down at the consumer's latest update.
+ *
+ * @param consumer The consumer.
+ * @param num Which gamepad to check. -1 will check for any gamepad.
+ * @param button The button to check.
+ */
+NK_API nk_bool nk_gamepad_consumer_is_button_down(struct nk_gamepad_consumer* consumer, int num, enum nk_gamepad_button button);
+
+/**
+ * Check whether a button was pressed between the consumer's last two updates.
+ *
+ * @param consumer The consumer.
+ * @param num Which gamepad to check. -1 will check for any gamepad.
+ * @param button The button to check.
+ */
+NK_API nk_bool nk_gamepad_consumer_is_button_pressed(struct nk_gamepad_consumer* consumer, int num, enum nk_gamepad_button button);
+
+/**
+ * Check whether a button was released between the consumer's last two updates.
+ *
+ * @param consumer The consumer.
+ * @param num Which gamepad to check. -1 will check for any gamepad.
+ * @param button The button to check.
+ */
+NK_API nk_bool nk_gamepad_consumer_is_button_released(struct nk_gamepad_consumer* consumer, int num, enum nk_gamepad_button button);
+
+#ifdef NK_GAMEPAD_TIMESTAMPS
+/**
+ * Get how long a button has been held down for, as of the latest update. Requires NK_GAMEPAD_TIMESTAMPS.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num The gamepad number.
+ * @param button The button to check.
+ *
+ * @return The time in nanoseconds since the button was pressed, or 0 if it isn't down.
+ *
+ * @code
+ * if (nk_gamepad_is_button_released(gamepads, 0, NK_GAMEPAD_BUTTON_X)) {
+ *   fire(charge);
+ * }
+ * charge = nk_gamepad_button_held_time(gamepads, 0, NK_GAMEPAD_BUTTON_X);
+ * @endcode
+ */
+NK_API nk_gamepad_time nk_gamepad_button_held_time(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button);
+
+/**
+ * Get how long ago a button was released, as of the latest update. Requires NK_GAMEPAD_TIMESTAMPS.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num The gamepad number.
+ * @param button The button to check.
+ *
+ * @return The time in nanoseconds since the button was released, or 0 if it is down or was never released.
+ */
+NK_API nk_gamepad_time nk_gamepad_button_released_time(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button);
+#endif
+
+#ifdef NK_GAMEPAD_HISTORY
+/**
+ * Check whether a button was pressed in any of the last few updates. Requires NK_GAMEPAD_HISTORY.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num Which gamepad to check. -1 will check for any available gamepad.
+ * @param button The button to check.
+ * @param updates How many updates to look back over, from 1 to 63. 1 is the same as nk_gamepad_is_button_pressed().
+ *
+ * @return True if the button was pressed within that many updates, false otherwise.
+ *
+ * @code
+ * // Buffer the jump input for 8 frames.
+ * if (on_ground && nk_gamepad_is_button_pressed_within(gamepads, 0, NK_GAMEPAD_BUTTON_A, 8)) {
+ *   jump();
+ * }
+ * @endcode
+ */
+NK_API nk_bool nk_gamepad_is_button_pressed_within(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, int updates);
+
+/**
+ * Check whether a button has been held down for at least the last few updates. Requires NK_GAMEPAD_HISTORY.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num Which gamepad to check. -1 will check for any available gamepad.
+ * @param button The button to check.
+ * @param updates How many updates it must have been down for, from 1 to 64.
+ */
+NK_API nk_bool nk_gamepad_is_button_held_for(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, int updates);
+
+/**
+ * Count how many times a button was pressed in the last few updates. Requires NK_GAMEPAD_HISTORY.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num The gamepad number.
+ * @param button The button to count presses of.
+ * @param updates How many updates to look back over, from 1 to 63.
+ *
+ * @return The number of presses, or 0 if the gamepad isn't available.
+ */
+NK_API int nk_gamepad_button_taps(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, int updates);
+#endif
+
+#ifdef NK_GAMEPAD_CALLBACKS
+/**
+ * Register a callback for when a button is pressed or released. Requires NK_GAMEPAD_CALLBACKS.
+ *
+ * Callbacks are made at the end of nk_gamepad_update(), only for the buttons that changed, so updates without any
+ * input don't do any work per button.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num The gamepad number, or -1 for all gamepads.
+ * @param button The button, or NK_GAMEPAD_BUTTON_INVALID for all buttons.
+ * @param callback The function to call.
+ * @param user_data Passed through to the callback.
+ *
+ * @return A handle for nk_gamepad_remove_callback(), or -1 if the arguments are invalid or there is no room left.
+ *
+ * @code
+ * static void on_start(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, nk_bool down, void* user_data) {
+ *   if (down) {
+ *     toggle_pause();
+ *   }
+ * }
+ *
+ * nk_gamepad_add_callback(gamepads, -1, NK_GAMEPAD_BUTTON_START, &on_start, NULL);
+ * @endcode
+ */
+NK_API int nk_gamepad_add_callback(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, nk_gamepad_button_fn callback, void* user_data);
+
+/**
+ * Unregister a button callback. Requires NK_GAMEPAD_CALLBACKS.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param handle The handle returned by nk_gamepad_add_callback().
+ */
+NK_API void nk_gamepad_remove_callback(struct nk_gamepads* gamepads, int handle);
+#endif
+
+#ifdef NK_GAMEPAD_PATTERNS
+/**
+ * Register a chord or a sequence of them to detect. Requires NK_GAMEPAD_PATTERNS.
+ *
+ * Each step is a mask of buttons to press together, in any order. Releasing a button part way through a chord means it
+ * has to be pressed again, and pressing a button that isn't next breaks the sequence. All the registered patterns are compiled
+ * into one transition table, so nk_gamepad_update() does the same small amount of work per button change however many
+ * there are.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param steps The buttons of each step, made with NK_GAMEPAD_BUTTON_FLAG().
+ * @param length How many steps there are, from 1 to NK_GAMEPAD_PATTERNS_LENGTH.
+ * @param timeout The most time in nanoseconds allowed between two presses, or 0 for no limit.
+ *
+ * @return A handle for nk_gamepad_is_pattern_matched(), or -1 if the arguments are invalid or the patterns no longer fit.
+ *
+ * @code
+ * unsigned int menu = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LB) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_RB) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_START);
+ * int operator_menu = nk_gamepad_add_pattern(gamepads, &menu, 1, 0);
+ *
+ * unsigned int code[] = {
+ *   NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_UP), NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_UP),
+ *   NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_DOWN), NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_DOWN),
+ * };
+ * int service = nk_gamepad_add_pattern(gamepads, code, 4, 500000000);
+ * @endcode
+ */
+NK_API int nk_gamepad_add_pattern(struct nk_gamepads* gamepads, const unsigned int* steps, int length, nk_gamepad_time timeout);
+
+/**
+ * Unregister a chord or sequence. Requires NK_GAMEPAD_PATTERNS.
+ *
+ * Patterns in progress on every gamepad start over.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param handle The handle returned by nk_gamepad_add_pattern().
+ */
+NK_API void nk_gamepad_remove_pattern(struct nk_gamepads* gamepads, int handle);
+
+/**
+ * Check whether a chord or sequence was completed in the latest update. Requires NK_GAMEPAD_PATTERNS.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num Which gamepad to check. -1 will check for any gamepad.
+ * @param handle The handle returned by nk_gamepad_add_pattern().
+ */
+NK_API nk_bool nk_gamepad_is_pattern_matched(struct nk_gamepads* gamepads, int num, int handle);
+#endif
+
+#ifdef NK_GAMEPAD_GESTURES
+/**
+ * Check whether a button was pressed a second time within NK_GAMEPAD_GESTURES_DOUBLE_TAP of the first. Requires
+ * NK_GAMEPAD_GESTURES.
+ *
+ * A third press starts over, so tapping quickly reports every other press.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num Which gamepad to check. -1 will check for any gamepad.
+ * @param button The button to check.
+ *
+ * @return True if the button was double tapped in the latest update, false otherwise.
+ */
+NK_API nk_bool nk_gamepad_is_button_double_tapped(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button);
+
+/**
+ * Check whether a button has just been held down for NK_GAMEPAD_GESTURES_LONG_PRESS. Requires NK_GAMEPAD_GESTURES.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num Which gamepad to check. -1 will check for any gamepad.
+ * @param button The button to check.
+ *
+ * @return True if the button became a long press in the latest update, false otherwise.
+ */
+NK_API nk_bool nk_gamepad_is_button_long_pressed(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button);
+
+/**
+ * Check whether a button was pressed, or repeated from being held down, like a key on a keyboard. Requires
+ * NK_GAMEPAD_GESTURES.
+ *
+ * Repeats start after NK_GAMEPAD_GESTURES_REPEAT_DELAY, and come every NK_GAMEPAD_GESTURES_REPEAT_INTERVAL, at most once
+ * an update.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num Which gamepad to check. -1 will check for any gamepad.
+ * @param button The button to check.
+ *
+ * @return True if the button was pressed or repeated in the latest update, false otherwise.
+ *
+ * @code
+ * if (nk_gamepad_is_button_repeated(gamepads, 0, NK_GAMEPAD_BUTTON_DOWN)) {
+ *   select_next_item();
+ * }
+ * @endcode
+ */
+NK_API nk_bool nk_gamepad_is_button_repeated(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button);
+#endif
+
+#ifdef NK_GAMEPAD_ACTIONS
+/**
+ * Set up an action set with no buttons bound. Requires NK_GAMEPAD_ACTIONS.
+ *
+ * @param set The action set.
+ * @param names The name of each action, which must outlive the set. The position of each name is its action number.
+ * @param count How many names there are, up to NK_GAMEPAD_ACTIONS_MAX. None of them may be NULL.
+ *
+ * @return True if the action set was set up, false if the arguments are invalid.
+ *
+ * @code
+ * enum { ACTION_CONFIRM, ACTION_CANCEL, ACTION_PAGE_NEXT };
+ * static const char* actions[] = { "confirm", "cancel", "page_next" };
+ *
+ * struct nk_gamepad_action_set menu;
+ * nk_gamepad_action_set_init(&menu, actions, 3);
+ * nk_gamepad_action_bind(&menu, ACTION_CONFIRM, -1, NK_GAMEPAD_BUTTON_A);
+ * nk_gamepad_action_bind(&menu, ACTION_CONFIRM, -1, NK_GAMEPAD_BUTTON_START);
+ * nk_gamepad_action_bind(&menu, ACTION_CANCEL, -1, NK_GAMEPAD_BUTTON_B);
+ * nk_gamepad_action_bind(&menu, ACTION_PAGE_NEXT, -1, NK_GAMEPAD_BUTTON_RB);
+ * nk_gamepad_set_action_set(gamepads, &menu);
+ * @endcode
+ */
+NK_API nk_bool nk_gamepad_action_set_init(struct nk_gamepad_action_set* set, const char* const* names, int count);
+
+/**
+ * Find the number of an action from its name. Requires NK_GAMEPAD_ACTIONS.
+ *
+ * @param set The action set.
+ * @param name The name of the action.
+ *
+ * @return The action number, or -1 if there is no action with that name.
+ */
+NK_API int nk_gamepad_action_find(const struct nk_gamepad_action_set* set, const char* name);
+
+/**
+ * Bind a button to an action. An action can have any number of buttons bound to it. Requires NK_GAMEPAD_ACTIONS.
+ *
+ * @param set The action set.
+ * @param action The action number.
+ * @param num The gamepad number, or -1 for all gamepads.
+ * @param button The button to bind.
+ */
+NK_API void nk_gamepad_action_bind(struct nk_gamepad_action_set* set, int action, int num, enum nk_gamepad_button button);
+
+/**
+ * Unbind a button from an action. Requires NK_GAMEPAD_ACTIONS.
+ *
+ * @param set The action set.
+ * @param action The action number.
+ * @param num The gamepad number, or -1 for all gamepads.
+ * @param button The button to unbind, or NK_GAMEPAD_BUTTON_INVALID for all of them.
+ */
+NK_API void nk_gamepad_action_unbind(struct nk_gamepad_action_set* set, int action, int num, enum nk_gamepad_button button);
+
+/**
+ * Choose the action set that actions are checked against. Requires NK_GAMEPAD_ACTIONS.
+ *
+ * Only the pointer is kept, so switching sets costs nothing, and changes made to a set apply straight away.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param set The action set to use, or NULL for none.
+ */
+NK_API void nk_gamepad_set_action_set(struct nk_gamepads* gamepads, const struct nk_gamepad_action_set* set);
+
+/**
+ * Check whether any of the buttons bound to an action are down. Requires NK_GAMEPAD_ACTIONS.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num Which gamepad to check. -1 will check for any available gamepad.
+ * @param action The action number, in the action set in use.
+ */
+NK_API nk_bool nk_gamepad_is_action_down(struct nk_gamepads* gamepads, int num, int action);
+
+/**
+ * Check whether an action was just pressed, meaning one of its buttons went down when none were. Requires
+ * NK_GAMEPAD_ACTIONS.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num Which gamepad to check. -1 will check for any available gamepad.
+ * @param action The action number, in the action set in use.
+ *
+ * @code
+ * if (nk_gamepad_is_action_pressed(gamepads, -1, ACTION_CONFIRM)) {
+ *   open_selected();
+ * }
+ * @endcode
+ */
+NK_API nk_bool nk_gamepad_is_action_pressed(struct nk_gamepads* gamepads, int num, int action);
+
+/**
+ * Check whether an action was just released, meaning the last of its buttons that were down went up. Requires
+ * NK_GAMEPAD_ACTIONS.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num Which gamepad to check. -1 will check for any available gamepad.
+ * @param action The action number, in the action set in use.
+ */
+NK_API nk_bool nk_gamepad_is_action_released(struct nk_gamepads* gamepads, int num, int action);
+#endif
+
+#ifdef NK_GAMEPAD_ACTIVE
+/**
+ * Get the device the user last pressed a button or key on. Requires NK_GAMEPAD_ACTIVE.
+ *
+ * This is kept by nk_gamepad_update() from the buttons that changed, so asking is free. Keys pressed on the keyboard
+ * of the Nuklear context count as NK_GAMEPAD_ACTIVE_KEYBOARD, which includes the keyboard input source.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param time Where to write when it was last touched. Can be NULL.
+ *
+ * @return The gamepad number, NK_GAMEPAD_ACTIVE_KEYBOARD, or -1 if nothing was pressed yet.
+ *
+ * @code
+ * if (nk_gamepad_active_changed(gamepads)) {
+ *   show_prompts(nk_gamepad_last_active(gamepads, NULL) == NK_GAMEPAD_ACTIVE_KEYBOARD ? PROMPTS_KEYBOARD : PROMPTS_GAMEPAD);
+ * }
+ * @endcode
+ */
+NK_API int nk_gamepad_last_active(struct nk_gamepads* gamepads, nk_gamepad_time* time);
+
+/**
+ * Check whether the last active device changed in the latest update. Requires NK_GAMEPAD_ACTIVE.
+ *
+ * @param gamepads The associated gamepad system.
+ *
+ * @return True if a different device than before was pressed in the latest update, false otherwise.
+ *
+ * @see nk_gamepad_last_active()
+ */
+NK_API nk_bool nk_gamepad_active_changed(struct nk_gamepads* gamepads);
+#endif
+
+#ifdef NK_GAMEPAD_STATS
+/**
+ * Get the usage statistics of the specified gamepad. Requires NK_GAMEPAD_STATS.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num The gamepad number.
+ *
+ * @return The statistics, or NULL if the gamepad number is invalid.
+ *
+ * @code
+ * const struct nk_gamepad_stats* stats = nk_gamepad_stats(gamepads, 0);
+ * if (stats->hold[NK_GAMEPAD_BUTTON_A] > 60 * 60) {
+ *   printf("A has been held for a minute, it may be stuck\n");
+ * }
+ * @endcode
+ */
+NK_API const struct nk_gamepad_stats* nk_gamepad_stats(struct nk_gamepads* gamepads, int num);
+
+/**
+ * Clear the usage statistics of a gamepad. Requires NK_GAMEPAD_STATS.
+ *
+ * @param gamepads The associated gamepad system.
+ * @param num The gamepad number, or -1 for all of them.
+ */
+NK_API void nk_gamepad_stats_reset(struct nk_gamepads* gamepads, int num);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#if defined(NK_GAMEPAD_IMPLEMENTATION) && !defined(NK_GAMEPAD_HEADER_ONLY)
+#ifndef NK_GAMEPAD_IMPLEMENTATION_ONCE
+#define NK_GAMEPAD_IMPLEMENTATION_ONCE
+
+// Platform detection.
+#if !defined(NK_GAMEPAD_SDL) && !defined(NK_GAMEPAD_GLFW) && !defined(NK_GAMEPAD_RAYLIB) && !defined(NK_GAMEPAD_PNTR) && !defined(NK_GAMEPAD_HIDRAW) && !defined(NK_GAMEPAD_KEYBOARD) && !defined(NK_GAMEPAD_NONE)
     #if defined(NK_SDL_RENDERER_IMPLEMENTATION) || defined(NK_SDL_GL2_IMPLEMENTATION) || defined(NK_SDL_GL3_IMPLEMENTATION) || defined(NK_SDL_GLES2_IMPLEMENTATION)
         #define NK_GAMEPAD_SDL
     #elif defined(NK_GLFW_RENDERER_IMPLEMENTATION) || defined(NK_GLFW_GL2_IMPLEMENTATION) || defined(NK_GLFW_GL3_IMPLEMENTATION) || defined(GLFW_INCLUDE_VULKAN)
@@ -274,295 +1387,1791 @@ NK_API struct nk_gamepad_input_source* nk_gamepad_input_source(struct nk_gamepad
     #endif
 #endif
 
-// Include all the enabled platform-specific implementations.
-#ifdef NK_GAMEPAD_SDL
-#include "nuklear_gamepad_sdl.h"
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <time.h>
+#if defined(NK_GAMEPAD_BUDGET) && !defined(CLOCK_MONOTONIC)
+// The processor time from clock() barely moves while the input source is blocked, so stalls would go unnoticed.
+#error "NK_GAMEPAD_BUDGET needs CLOCK_MONOTONIC, so define _POSIX_C_SOURCE as 199309L or later before any includes"
+#endif
+#endif
+
+#ifndef NK_GAMEPAD_ATOMIC_FETCH_ADD
+/**
+ * Atomic operations on unsigned ints, used by the parts that may be written from other threads. Define all of them to
+ * provide your own.
+ *
+ * @internal
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define NK_GAMEPAD_ATOMIC_FETCH_ADD(ptr, value) __atomic_fetch_add((ptr), (value), __ATOMIC_ACQ_REL)
+#define NK_GAMEPAD_ATOMIC_OR(ptr, value) ((void)__atomic_fetch_or((ptr), (value), __ATOMIC_ACQ_REL))
+#define NK_GAMEPAD_ATOMIC_AND(ptr, value) ((void)__atomic_fetch_and((ptr), (value), __ATOMIC_ACQ_REL))
+#define NK_GAMEPAD_ATOMIC_LOAD(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define NK_GAMEPAD_ATOMIC_STORE(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#define NK_GAMEPAD_ATOMIC_FENCE_RELEASE() __atomic_thread_fence(__ATOMIC_RELEASE)
+#define NK_GAMEPAD_ATOMIC_FENCE_ACQUIRE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define NK_GAMEPAD_ATOMIC_FETCH_ADD(ptr, value) ((unsigned int)_InterlockedExchangeAdd((volatile long*)(ptr), (long)(value)))
+#define NK_GAMEPAD_ATOMIC_OR(ptr, value) ((void)_InterlockedOr((volatile long*)(ptr), (long)(value)))
+#define NK_GAMEPAD_ATOMIC_AND(ptr, value) ((void)_InterlockedAnd((volatile long*)(ptr), (long)(value)))
+#define NK_GAMEPAD_ATOMIC_LOAD(ptr) ((unsigned int)_InterlockedOr((volatile long*)(ptr), 0))
+#define NK_GAMEPAD_ATOMIC_STORE(ptr, value) ((void)_InterlockedExchange((volatile long*)(ptr), (long)(value)))
+#define NK_GAMEPAD_ATOMIC_FENCE_RELEASE() MemoryBarrier()
+#define NK_GAMEPAD_ATOMIC_FENCE_ACQUIRE() MemoryBarrier()
+#else
+// Without atomics, writers must all be on the same thread.
+#define NK_GAMEPAD_ATOMIC_FETCH_ADD(ptr, value) ((*(ptr) += (value)) - (value))
+#define NK_GAMEPAD_ATOMIC_OR(ptr, value) ((void)(*(ptr) |= (value)))
+#define NK_GAMEPAD_ATOMIC_AND(ptr, value) ((void)(*(ptr) &= (value)))
+#define NK_GAMEPAD_ATOMIC_LOAD(ptr) (*(ptr))
+#define NK_GAMEPAD_ATOMIC_STORE(ptr, value) ((void)(*(ptr) = (value)))
+#define NK_GAMEPAD_ATOMIC_FENCE_RELEASE() ((void)0)
+#define NK_GAMEPAD_ATOMIC_FENCE_ACQUIRE() ((void)0)
+#endif
+#endif  // NK_GAMEPAD_ATOMIC_FETCH_ADD
+
+// Include all the enabled platform-specific implementations.
+#ifdef NK_GAMEPAD_SDL
+#include "nuklear_gamepad_sdl.h"
+#endif
+#ifdef NK_GAMEPAD_GLFW
+#include "nuklear_gamepad_glfw.h"
+#endif
+#ifdef NK_GAMEPAD_RAYLIB
+#include "nuklear_gamepad_raylib.h"
+#endif
+#ifdef NK_GAMEPAD_PNTR
+#include "nuklear_gamepad_pntr.h"
+#endif
+#ifdef NK_GAMEPAD_HIDRAW
+#include "nuklear_gamepad_hidraw.h"
+#endif
+#ifdef NK_GAMEPAD_KEYBOARD
+#include "nuklear_gamepad_keyboard.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(NK_GAMEPAD_EVENTS) || defined(NK_GAMEPAD_TIMESTAMPS) || defined(NK_GAMEPAD_ACTIVE) || defined(NK_GAMEPAD_PATTERNS) || defined(NK_GAMEPAD_GESTURES)
+/**
+ * Read the clock used to timestamp input.
+ *
+ * @internal
+ */
+static nk_gamepad_time nk_gamepad_clock(struct nk_gamepads* gamepads) {
+    return (gamepads->clock != NULL) ? gamepads->clock(gamepads->clock_user_data) : nk_gamepad_now();
+}
+#endif
+
+#if defined(NK_GAMEPAD_STATS) || defined(NK_GAMEPAD_CALLBACKS) || defined(NK_GAMEPAD_TIMESTAMPS) || defined(NK_GAMEPAD_PATTERNS) || defined(NK_GAMEPAD_GESTURES)
+/**
+ * The index of the lowest set bit of a non-zero mask.
+ *
+ * @internal
+ */
+static int nk_gamepad_bit_index(unsigned int mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#else
+    int index = 0;
+    while ((mask & 1) == 0) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+#endif
+
+#ifdef NK_GAMEPAD_TRACE
+/**
+ * Publish the counters of the frame in progress, and start counting the next one.
+ *
+ * @internal
+ */
+static void nk_gamepad_trace_frame(struct nk_gamepads* gamepads) {
+    gamepads->trace.backend_calls = gamepads->trace.pending.backend_calls;
+    gamepads->trace.pads_scanned = gamepads->trace.pending.pads_scanned;
+    gamepads->trace.events = gamepads->trace.pending.events;
+    gamepads->trace.pending.backend_calls = 0;
+    gamepads->trace.pending.pads_scanned = 0;
+    gamepads->trace.pending.events = 0;
+}
+#endif
+
+#ifdef NK_GAMEPAD_STATS
+/**
+ * Fold the latest update into the usage statistics, visiting only the buttons that are down or changed.
+ *
+ * @internal
+ */
+static void nk_gamepad_stats_update(struct nk_gamepad* gamepad) {
+    struct nk_gamepad_stats* stats = &gamepad->stats;
+    // The previous buttons aren't kept while the gamepad is unavailable, so it starts over from none when it comes back.
+    unsigned int prev = gamepad->buttons_prev;
+    if (gamepad->available != stats->was_available) {
+        if (gamepad->available) {
+            stats->connects++;
+            prev = 0;
+        }
+        else {
+            stats->disconnects++;
+            nk_zero(stats->hold, sizeof(stats->hold));
+        }
+        stats->was_available = gamepad->available;
+    }
+
+    // A gamepad that isn't there holds nothing, and only idles.
+    if (gamepad->available == nk_false) {
+        stats->idle++;
+        return;
+    }
+
+    const unsigned int mask = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST) - 1;
+    unsigned int buttons = gamepad->buttons & mask;
+    unsigned int changed = (gamepad->buttons ^ prev) & mask;
+    stats->idle = changed ? 0 : stats->idle + 1;
+
+    for (unsigned int pressed = changed & buttons; pressed; pressed &= pressed - 1) {
+        stats->presses[nk_gamepad_bit_index(pressed)]++;
+    }
+    for (unsigned int released = changed & ~buttons; released; released &= released - 1) {
+        stats->hold[nk_gamepad_bit_index(released)] = 0;
+    }
+    for (unsigned int down = buttons; down; down &= down - 1) {
+        int button = nk_gamepad_bit_index(down);
+        stats->held[button]++;
+        stats->hold[button]++;
+    }
+}
+#endif
+
+#ifdef NK_GAMEPAD_JOURNAL
+/**
+ * Journal a name change when the input source reports a different name than last time.
+ *
+ * @internal
+ */
+static void nk_gamepad_journal_name(struct nk_gamepads* gamepads, int num, const char* name) {
+    // FNV-1a, with 0 kept for a gamepad that hasn't been named yet.
+    unsigned int hash = 2166136261u;
+    for (const char* c = (name != NULL) ? name : ""; *c != '\0'; c++) {
+        hash = (hash ^ (unsigned char)*c) * 16777619u;
+    }
+    hash = (hash == 0) ? 1 : hash;
+
+    unsigned int previous = gamepads->journal.name_hash[num];
+    gamepads->journal.name_hash[num] = hash;
+    if (previous != 0 && previous != hash) {
+        nk_gamepad_journal_write(gamepads, num, "nuklear_gamepad", NK_GAMEPAD_JOURNAL_NAME_CHANGED, 0);
+    }
+}
+#endif
+
+#ifdef NK_GAMEPAD_BUDGET
+/**
+ * Check the input source update against the budget, and back off from polling when it overran.
+ *
+ * @internal
+ */
+static void nk_gamepad_budget_update(struct nk_gamepads* gamepads, nk_gamepad_time cost) {
+    struct nk_gamepad_budget* budget = &gamepads->budget;
+    budget->last = cost;
+    if (budget->limit == 0 || cost <= budget->limit) {
+        budget->backoff = 0;
+        return;
+    }
+
+    budget->stalls++;
+    budget->backoff = (budget->backoff == 0) ? 1 : NK_MIN(budget->backoff * 2, NK_GAMEPAD_BUDGET_MAX_SKIP);
+    budget->skip = budget->backoff;
+    NK_GAMEPAD_JOURNAL_WRITE(gamepads, -1, "nuklear_gamepad", NK_GAMEPAD_JOURNAL_STALL, (int)(cost / 1000));
+}
+#endif
+
+#ifdef NK_GAMEPAD_EVENTS
+/**
+ * Write an event for each gamepad whose buttons changed in this update, which includes letting go of them all when it
+ * becomes unavailable.
+ *
+ * @internal
+ */
+static void nk_gamepad_events_update(struct nk_gamepads* gamepads) {
+    nk_gamepad_time time = 0;
+    nk_bool timed = nk_false;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        const struct nk_gamepad* gamepad = &gamepads->gamepads[num];
+        // A gamepad that went away let go of its buttons.
+        unsigned int buttons = gamepad->available ? gamepad->buttons : 0;
+        unsigned int changed = buttons ^ gamepads->events.buttons[num];
+        if (changed == 0) {
+            continue;
+        }
+
+        // Only read the clock when something changed.
+        if (!timed) {
+            time = nk_gamepad_clock(gamepads);
+            timed = nk_true;
+        }
+        struct nk_gamepad_event* event = &gamepads->events.entries[gamepads->events.head++ & (NK_GAMEPAD_EVENTS_SIZE - 1)];
+        event->time = time;
+        event->num = num;
+        event->buttons = buttons;
+        event->changed = changed;
+        gamepads->events.buttons[num] = buttons;
+    }
+}
+#endif
+
+#ifdef NK_GAMEPAD_TIMESTAMPS
+/**
+ * Stamp the buttons that were pressed or released in this update.
+ *
+ * @internal
+ */
+static void nk_gamepad_timestamps_update(struct nk_gamepad* gamepad, nk_gamepad_time time) {
+    unsigned int changed = (gamepad->buttons ^ gamepad->buttons_prev) & (NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST) - 1);
+    for (; changed; changed &= changed - 1) {
+        int button = nk_gamepad_bit_index(changed);
+        if (gamepad->buttons & NK_GAMEPAD_BUTTON_FLAG(button)) {
+            gamepad->pressed_at[button] = time;
+        }
+        else {
+            gamepad->released_at[button] = time;
+            gamepad->was_released |= NK_GAMEPAD_BUTTON_FLAG(button);
+        }
+    }
+}
+#endif
+
+#ifdef NK_GAMEPAD_HISTORY
+/**
+ * Shift the latest state of each button into its history.
+ *
+ * @internal
+ */
+static void nk_gamepad_history_update(struct nk_gamepad* gamepad) {
+    unsigned int buttons = gamepad->available ? gamepad->buttons : 0;
+    for (int i = 0; i < NK_GAMEPAD_BUTTON_LAST; i++) {
+        gamepad->history[i] = (gamepad->history[i] << 1) | ((buttons >> i) & 1u);
+    }
+}
+
+/**
+ * The history bits of a button that were presses, meaning down in that update but not the one before, within the
+ * given number of updates.
+ *
+ * @internal
+ */
+static unsigned long long nk_gamepad_history_presses(const struct nk_gamepad* gamepad, enum nk_gamepad_button button, int updates) {
+    unsigned long long history = gamepad->history[button];
+    return history & ~(history >> 1) & ((1ULL << updates) - 1);
+}
+#endif
+
+#ifdef NK_GAMEPAD_CALLBACKS
+/**
+ * Call back for each watched button that changed in this update, which includes letting go of them all when the
+ * gamepad becomes unavailable.
+ *
+ * @internal
+ */
+static void nk_gamepad_callbacks_update(struct nk_gamepads* gamepads) {
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        const struct nk_gamepad* gamepad = &gamepads->gamepads[num];
+        unsigned int buttons = gamepad->available ? gamepad->buttons : 0;
+        unsigned int changed = (buttons ^ gamepads->callbacks.buttons[num]) & gamepads->callbacks.watched[num];
+        gamepads->callbacks.buttons[num] = buttons;
+        if (changed == 0) {
+            continue;
+        }
+
+        for (int i = 0; i < NK_GAMEPAD_CALLBACKS_MAX; i++) {
+            const struct nk_gamepad_callback* entry = &gamepads->callbacks.entries[i];
+            if (entry->callback == NULL || (entry->num >= 0 && entry->num != num)) {
+                continue;
+            }
+            // A callback may remove itself, so check it is still there for each button.
+            for (unsigned int bits = changed & entry->buttons; bits && entry->callback; bits &= bits - 1) {
+                int button = nk_gamepad_bit_index(bits);
+                nk_bool down = (buttons & NK_GAMEPAD_BUTTON_FLAG(button)) ? nk_true : nk_false;
+                entry->callback(gamepads, num, (enum nk_gamepad_button)button, down, entry->user_data);
+            }
+        }
+    }
+}
+
+/**
+ * Recalculate which buttons of each gamepad any callback wants.
+ *
+ * @internal
+ */
+static void nk_gamepad_callbacks_watch(struct nk_gamepads* gamepads) {
+    nk_zero(gamepads->callbacks.watched, sizeof(gamepads->callbacks.watched));
+    for (int i = 0; i < NK_GAMEPAD_CALLBACKS_MAX; i++) {
+        const struct nk_gamepad_callback* entry = &gamepads->callbacks.entries[i];
+        if (entry->callback == NULL) {
+            continue;
+        }
+        for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+            if (entry->num < 0 || entry->num == num) {
+                gamepads->callbacks.watched[num] |= entry->buttons;
+            }
+        }
+    }
+}
+#endif
+
+#ifdef NK_GAMEPAD_PATTERNS
+/**
+ * How many 32 bit words a set of pattern positions takes.
+ *
+ * @internal
+ */
+#define NK_GAMEPAD_PATTERNS_WORDS (NK_GAMEPAD_PATTERNS_POSITIONS / 32)
+
+/**
+ * Where matching can be in the registered patterns: the step of a pattern, and which buttons of its chord are down.
+ *
+ * @internal
+ */
+struct nk_gamepad_pattern_positions {
+    int count;
+    int base[NK_GAMEPAD_PATTERNS_MAX][NK_GAMEPAD_PATTERNS_LENGTH + 1]; /** The first position of each step. */
+    unsigned char pattern[NK_GAMEPAD_PATTERNS_POSITIONS];
+    unsigned char step[NK_GAMEPAD_PATTERNS_POSITIONS];
+    unsigned short held[NK_GAMEPAD_PATTERNS_POSITIONS]; /** The buttons of the step's chord that are down. */
+};
+
+/**
+ * Pack the bits of a value that are in the mask together, lowest first.
+ *
+ * @internal
+ */
+static int nk_gamepad_pattern_rank(unsigned int value, unsigned int mask) {
+    int rank = 0;
+    int bit = 0;
+    for (; mask; mask &= mask - 1, bit++) {
+        if (value & mask & (~mask + 1)) {
+            rank |= 1 << bit;
+        }
+    }
+    return rank;
+}
+
+/**
+ * Find the position of a step of a pattern, with some of its chord down.
+ *
+ * @internal
+ */
+static int nk_gamepad_pattern_position(const struct nk_gamepad_patterns* patterns, const struct nk_gamepad_pattern_positions* positions, int pattern, int step, unsigned int held) {
+    if (step == patterns->entries[pattern].length) {
+        return positions->base[pattern][step];
+    }
+    return positions->base[pattern][step] + nk_gamepad_pattern_rank(held, patterns->entries[pattern].steps[step]);
+}
+
+/**
+ * Find the positions a set of positions leads to on an input, along with the start of every pattern.
+ *
+ * @internal
+ */
+static void nk_gamepad_patterns_step(const struct nk_gamepad_patterns* patterns, const struct nk_gamepad_pattern_positions* positions, const unsigned int* from, int symbol, unsigned int* to) {
+    nk_zero(to, sizeof(unsigned int) * NK_GAMEPAD_PATTERNS_WORDS);
+    for (int i = 0; i < NK_GAMEPAD_PATTERNS_MAX; i++) {
+        if (patterns->entries[i].length > 0) {
+            int start = positions->base[i][0];
+            to[start / 32] |= 1u << (start % 32);
+        }
+    }
+
+    for (int i = 0; i < positions->count; i++) {
+        if ((from[i / 32] & (1u << (i % 32))) == 0) {
+            continue;
+        }
+
+        const struct nk_gamepad_pattern* pattern = &patterns->entries[positions->pattern[i]];
+        int step = positions->step[i];
+        unsigned int held = positions->held[i];
+        if (step == pattern->length) {
+            // Completed patterns are only reported on the input that completed them.
+            continue;
+        }
+
+        int target;
+        if (symbol < NK_GAMEPAD_BUTTON_LAST) {
+            unsigned int flag = (unsigned int)NK_GAMEPAD_BUTTON_FLAG(symbol);
+            if ((pattern->steps[step] & flag) == 0 || (held & flag) != 0) {
+                continue;
+            }
+            held |= flag;
+            if (held == pattern->steps[step]) {
+                step++;
+                held = 0;
+            }
+        }
+        else if (symbol < NK_GAMEPAD_BUTTON_LAST * 2) {
+            held &= ~(unsigned int)NK_GAMEPAD_BUTTON_FLAG(symbol - NK_GAMEPAD_BUTTON_LAST);
+        }
+        else if (pattern->timeout != 0 && pattern->timeout <= patterns->timeouts[symbol - NK_GAMEPAD_BUTTON_LAST * 2]) {
+            continue;
+        }
+        target = nk_gamepad_pattern_position(patterns, positions, positions->pattern[i], step, held);
+        to[target / 32] |= 1u << (target % 32);
+    }
+}
+
+/**
+ * Compile the registered patterns into a transition table, by following every set of positions that input can lead to.
+ *
+ * @return False if there are too many positions or states for the table.
+ *
+ * @internal
+ */
+static nk_bool nk_gamepad_patterns_compile(struct nk_gamepad_patterns* patterns) {
+    struct nk_gamepad_pattern_positions positions;
+    positions.count = 0;
+    patterns->levels = 0;
+    for (int i = 0; i < NK_GAMEPAD_PATTERNS_MAX; i++) {
+        const struct nk_gamepad_pattern* pattern = &patterns->entries[i];
+        if (pattern->length == 0) {
+            continue;
+        }
+
+        // Every part of each chord that can be held, and then the completed pattern.
+        for (int step = 0; step <= pattern->length; step++) {
+            unsigned int mask = (step == pattern->length) ? 0 : pattern->steps[step];
+            int count = (step == pattern->length) ? 1 : nk_gamepad_pattern_rank(mask, mask);
+            if (positions.count + count > NK_GAMEPAD_PATTERNS_POSITIONS) {
+                return nk_false;
+            }
+            positions.base[i][step] = positions.count;
+            for (unsigned int held = (mask - 1) & mask; ; held = (held - 1) & mask) {
+                int position = positions.count + nk_gamepad_pattern_rank(held, mask);
+                positions.pattern[position] = (unsigned char)i;
+                positions.step[position] = (unsigned char)step;
+                positions.held[position] = (unsigned short)held;
+                if (held == 0) {
+                    break;
+                }
+            }
+            positions.count += count;
+        }
+
+        // Keep the distinct timeouts in order.
+        if (pattern->timeout != 0) {
+            int level = 0;
+            while (level < patterns->levels && patterns->timeouts[level] < pattern->timeout) {
+                level++;
+            }
+            if (level == patterns->levels || patterns->timeouts[level] != pattern->timeout) {
+                for (int j = patterns->levels; j > level; j--) {
+                    patterns->timeouts[j] = patterns->timeouts[j - 1];
+                }
+                patterns->timeouts[level] = pattern->timeout;
+                patterns->levels++;
+            }
+        }
+    }
+
+    // Walk the sets of positions breadth first, starting from nothing being held.
+    unsigned int sets[NK_GAMEPAD_PATTERNS_STATES][NK_GAMEPAD_PATTERNS_WORDS];
+    unsigned int none[NK_GAMEPAD_PATTERNS_WORDS];
+    nk_zero(none, sizeof(none));
+    nk_gamepad_patterns_step(patterns, &positions, none, NK_GAMEPAD_BUTTON_LAST, sets[0]);
+    int states = 1;
+    for (int state = 0; state < states; state++) {
+        patterns->accept[state] = 0;
+        for (int i = 0; i < NK_GAMEPAD_PATTERNS_MAX; i++) {
+            if (patterns->entries[i].length > 0) {
+                int done = positions.base[i][patterns->entries[i].length];
+                if (sets[state][done / 32] & (1u << (done % 32))) {
+                    patterns->accept[state] |= 1u << i;
+                }
+            }
+        }
+
+        for (int symbol = 0; symbol < NK_GAMEPAD_BUTTON_LAST * 2 + patterns->levels; symbol++) {
+            unsigned int to[NK_GAMEPAD_PATTERNS_WORDS];
+            nk_gamepad_patterns_step(patterns, &positions, sets[state], symbol, to);
+
+            int target = 0;
+            for (; target < states; target++) {
+                int word = 0;
+                while (word < NK_GAMEPAD_PATTERNS_WORDS && sets[target][word] == to[word]) {
+                    word++;
+                }
+                if (word == NK_GAMEPAD_PATTERNS_WORDS) {
+                    break;
+                }
+            }
+            if (target == states) {
+                if (states == NK_GAMEPAD_PATTERNS_STATES) {
+                    return nk_false;
+                }
+                for (int word = 0; word < NK_GAMEPAD_PATTERNS_WORDS; word++) {
+                    sets[states][word] = to[word];
+                }
+                states++;
+            }
+            patterns->next[state][symbol] = (unsigned char)target;
+        }
+    }
+
+    return nk_true;
+}
+
+/**
+ * Step each gamepad through the compiled patterns with the buttons that changed in this update.
+ *
+ * @internal
+ */
+static void nk_gamepad_patterns_update(struct nk_gamepads* gamepads) {
+    struct nk_gamepad_patterns* patterns = &gamepads->patterns;
+    nk_gamepad_time time = 0;
+    nk_bool timed = nk_false;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        const struct nk_gamepad* gamepad = &gamepads->gamepads[num];
+        unsigned int changed = (gamepad->buttons ^ gamepad->buttons_prev) & (NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST) - 1);
+        patterns->matched[num] = 0;
+        if (gamepad->available == nk_false) {
+            // Start over from nothing held when it comes back.
+            patterns->state[num] = 0;
+            continue;
+        }
+        if (changed == 0) {
+            continue;
+        }
+
+        // Releases first, so a button let go of and pressed again in one update counts as pressed.
+        unsigned int state = patterns->state[num];
+        for (unsigned int released = changed & ~gamepad->buttons; released; released &= released - 1) {
+            state = patterns->next[state][NK_GAMEPAD_BUTTON_LAST + nk_gamepad_bit_index(released)];
+        }
+        for (unsigned int pressed = changed & gamepad->buttons; pressed; pressed &= pressed - 1) {
+            if (patterns->levels > 0) {
+                // Drop the patterns that waited too long for this press.
+                if (!timed) {
+                    time = nk_gamepad_clock(gamepads);
+                    timed = nk_true;
+                }
+                nk_gamepad_time elapsed = time - patterns->pressed_at[num];
+                int level = 0;
+                while (level < patterns->levels && patterns->timeouts[level] < elapsed) {
+                    level++;
+                }
+                if (level > 0) {
+                    state = patterns->next[state][NK_GAMEPAD_BUTTON_LAST * 2 + level - 1];
+                }
+                patterns->pressed_at[num] = time;
+            }
+            state = patterns->next[state][nk_gamepad_bit_index(pressed)];
+            patterns->matched[num] |= patterns->accept[state];
+        }
+        patterns->state[num] = (unsigned char)state;
+    }
+}
+#endif
+
+#ifdef NK_GAMEPAD_GESTURES
+/**
+ * Step the gesture state of the buttons that changed, or whose deadline passed.
+ *
+ * @internal
+ */
+static void nk_gamepad_gestures_update(struct nk_gamepads* gamepads) {
+    struct nk_gamepad_gestures* gestures = &gamepads->gestures;
+    nk_gamepad_time time = 0;
+    nk_bool timed = nk_false;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        const struct nk_gamepad* gamepad = &gamepads->gamepads[num];
+        unsigned int changed = (gamepad->buttons ^ gamepad->buttons_prev) & (NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST) - 1);
+        gestures->double_tapped[num] = 0;
+        gestures->long_pressed[num] = 0;
+        gestures->repeated[num] = 0;
+        if (gamepad->available == nk_false) {
+            gestures->held[num] = 0;
+            continue;
+        }
+        if (changed == 0 && gestures->held[num] == 0) {
+            continue;
+        }
+
+        // Only read the clock when something changed or is held.
+        if (!timed) {
+            time = nk_gamepad_clock(gamepads);
+            timed = nk_true;
+        }
+        if (changed == 0 && time < gestures->next[num]) {
+            continue;
+        }
+
+        for (unsigned int pressed = changed & gamepad->buttons; pressed; pressed &= pressed - 1) {
+            int button = nk_gamepad_bit_index(pressed);
+            const unsigned int flag = NK_GAMEPAD_BUTTON_FLAG(button);
+            if ((gestures->tapped[num] & flag) != 0 && time - gestures->tapped_at[num][button] <= NK_GAMEPAD_GESTURES_DOUBLE_TAP) {
+                gestures->double_tapped[num] |= flag;
+                gestures->tapped[num] &= ~flag;
+            }
+            else {
+                gestures->tapped_at[num][button] = time;
+                gestures->tapped[num] |= flag;
+            }
+            gestures->long_at[num][button] = time + NK_GAMEPAD_GESTURES_LONG_PRESS;
+            gestures->waiting[num] |= flag;
+            gestures->repeat_at[num][button] = time + NK_GAMEPAD_GESTURES_REPEAT_DELAY;
+        }
+        gestures->repeated[num] = changed & gamepad->buttons;
+        gestures->held[num] = (gestures->held[num] | (changed & gamepad->buttons)) & ~(changed & ~gamepad->buttons);
+
+        // Fire the deadlines that passed, and find the next one.
+        nk_gamepad_time next = ~(nk_gamepad_time)0;
+        for (unsigned int held = gestures->held[num]; held; held &= held - 1) {
+            int button = nk_gamepad_bit_index(held);
+            const unsigned int flag = NK_GAMEPAD_BUTTON_FLAG(button);
+            nk_gamepad_time* long_at = &gestures->long_at[num][button];
+            nk_gamepad_time* repeat_at = &gestures->repeat_at[num][button];
+            if ((gestures->waiting[num] & flag) != 0 && time >= *long_at) {
+                gestures->long_pressed[num] |= flag;
+                gestures->waiting[num] &= ~flag;
+            }
+            if (time >= *repeat_at) {
+                gestures->repeated[num] |= flag;
+                *repeat_at += NK_GAMEPAD_GESTURES_REPEAT_INTERVAL;
+                if (*repeat_at <= time) {
+                    *repeat_at = time + NK_GAMEPAD_GESTURES_REPEAT_INTERVAL;
+                }
+            }
+            if ((gestures->waiting[num] & flag) != 0 && *long_at < next) {
+                next = *long_at;
+            }
+            if (*repeat_at < next) {
+                next = *repeat_at;
+            }
+        }
+        gestures->next[num] = next;
+    }
+}
+#endif
+
+#ifdef NK_GAMEPAD_ACTIVE
+/**
+ * Move the last active device to whichever had a button or key pressed in this update, with the keyboard last.
+ *
+ * @internal
+ */
+static void nk_gamepad_active_update(struct nk_gamepads* gamepads) {
+    int active = -1;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        const struct nk_gamepad* gamepad = &gamepads->gamepads[num];
+        if (gamepad->available && (gamepad->buttons & ~gamepad->buttons_prev) != 0) {
+            active = num;
+            break;
+        }
+    }
+
+    // The keyboard input source reads the same keys, so this also takes over from its gamepad.
+    if (gamepads->ctx != NULL) {
+        const struct nk_input* input = &gamepads->ctx->input;
+        nk_bool pressed = (input->keyboard.text_len > 0) ? nk_true : nk_false;
+        for (int key = NK_KEY_NONE + 1; key < NK_KEY_MAX && pressed == nk_false; key++) {
+            pressed = nk_input_is_key_pressed(input, (enum nk_keys)key);
+        }
+        if (pressed) {
+            active = NK_GAMEPAD_ACTIVE_KEYBOARD;
+        }
+    }
+
+    // Only read the clock when something was pressed.
+    gamepads->active.changed = nk_false;
+    if (active == -1) {
+        return;
+    }
+    gamepads->active.changed = (active != gamepads->active.num) ? nk_true : nk_false;
+    gamepads->active.num = active;
+    gamepads->active.time = nk_gamepad_clock(gamepads);
+}
+#endif
+
+#ifndef NK_GAMEPAD_DEFAULT_INPUT_SOURCE
+static struct nk_gamepad_input_source nk_gamepad_none_input_source(void* user_data) {
+    struct nk_gamepad_input_source source = {
+        .user_data = user_data
+    };
+    return source;
+}
+
+#define NK_GAMEPAD_DEFAULT_INPUT_SOURCE nk_gamepad_none_input_source
+#endif
+
+NK_API nk_bool nk_gamepad_init(struct nk_gamepads* gamepads, struct nk_context* ctx, void* user_data) {
+    return nk_gamepad_init_with_source(gamepads, ctx, NK_GAMEPAD_DEFAULT_INPUT_SOURCE(user_data));
+}
+
+NK_API nk_bool nk_gamepad_init_with_source(struct nk_gamepads* gamepads, struct nk_context* ctx, struct nk_gamepad_input_source input_source) {
+    if (gamepads == NULL) {
+        return nk_false;
+    }
+
+    // Initialize the gamepads as a default state.
+    nk_zero(gamepads, sizeof(struct nk_gamepads));
+    gamepads->ctx = ctx;
+    gamepads->input_source = input_source;
+#ifdef NK_GAMEPAD_BUDGET
+    gamepads->budget.limit = NK_GAMEPAD_BUDGET_DEFAULT;
+#endif
+#ifdef NK_GAMEPAD_ACTIVE
+    gamepads->active.num = -1;
+#endif
+
+    // Set the default state for all gamepads.
+    for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
+        // Available
+        gamepads->gamepads[i].available = nk_true;
+
+        // Name
+        int j;
+        const char* name_prefix = NK_GAMEPAD_NAME_PREFIX;
+        for (j = 0; j < nk_strlen(name_prefix); j++) {
+            gamepads->gamepads[i].name[j] = name_prefix[j];
+        }
+
+        // Add the # of the controller to the name.
+        nk_itoa(&gamepads->gamepads[i].name[j], (long)(i + 1));
+    }
+
+    if (input_source.init) {
+        NK_GAMEPAD_TRACE_COUNT(gamepads, backend_calls, 1);
+        NK_GAMEPAD_TRACE_BEGIN("nk_gamepad_init");
+        nk_bool initialized = input_source.init(gamepads, input_source.user_data);
+        NK_GAMEPAD_TRACE_END("nk_gamepad_init");
+        if (initialized == nk_false) {
+            return nk_false;
+        }
+    }
+
+    // Set all the states as the same as their previous states so that they don't trigger any events.
+    for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
+        gamepads->gamepads[i].buttons_prev = gamepads->gamepads[i].buttons;
+#ifdef NK_GAMEPAD_STATS
+        gamepads->gamepads[i].stats.was_available = gamepads->gamepads[i].available;
+#endif
+#ifdef NK_GAMEPAD_EVENTS
+        gamepads->events.buttons[i] = gamepads->gamepads[i].available ? gamepads->gamepads[i].buttons : 0;
+#endif
+#ifdef NK_GAMEPAD_CALLBACKS
+        gamepads->callbacks.buttons[i] = gamepads->gamepads[i].available ? gamepads->gamepads[i].buttons : 0;
+#endif
+    }
+
+#ifdef NK_GAMEPAD_TRACE
+    nk_gamepad_trace_frame(gamepads);
+#endif
+
+    return nk_true;
+}
+
+NK_API void nk_gamepad_free(struct nk_gamepads* gamepads) {
+    if (gamepads == NULL) {
+        return;
+    }
+
+    // Tell the runner that we are freeing the gamepads.
+    if (gamepads->input_source.free) {
+        NK_GAMEPAD_TRACE_BEGIN("nk_gamepad_free");
+        gamepads->input_source.free(gamepads, gamepads->input_source.user_data);
+        NK_GAMEPAD_TRACE_END("nk_gamepad_free");
+    }
+
+    // Reset the default state of the gamepad data.
+    nk_zero(gamepads, sizeof(struct nk_gamepads));
+}
+
+NK_API void nk_gamepad_button(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, nk_bool down) {
+    if (gamepads == NULL || num < 0 || num >= NK_GAMEPAD_MAX || gamepads->gamepads[num].available == nk_false) {
+        return;
+    }
+
+    if (down) {
+        gamepads->gamepads[num].buttons |= NK_GAMEPAD_BUTTON_FLAG(button);
+    }
+    else {
+        gamepads->gamepads[num].buttons &= ~NK_GAMEPAD_BUTTON_FLAG(button);
+    }
+}
+
+NK_API void nk_gamepad_set_buttons(struct nk_gamepads* gamepads, int num, unsigned int buttons) {
+    if (gamepads == NULL || num < 0 || num >= NK_GAMEPAD_MAX || gamepads->gamepads[num].available == nk_false) {
+        return;
+    }
+
+    NK_GAMEPAD_SET_BUTTONS(gamepads, num, buttons & (NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST) - 1));
+}
+
+#ifdef NK_GAMEPAD_THREADSAFE
+NK_API void nk_gamepad_button_async(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, nk_bool down) {
+    // Availability is only read on the update thread, so it isn't checked here.
+    if (gamepads == NULL || num < 0 || num >= NK_GAMEPAD_MAX || button < NK_GAMEPAD_BUTTON_FIRST || button >= NK_GAMEPAD_BUTTON_LAST) {
+        return;
+    }
+
+    struct nk_gamepad* gamepad = &gamepads->gamepads[num];
+    const unsigned int flag = (unsigned int)NK_GAMEPAD_BUTTON_FLAG(button);
+    if (down) {
+        NK_GAMEPAD_ATOMIC_OR(&gamepad->staged, flag);
+        NK_GAMEPAD_ATOMIC_OR(&gamepad->latched, flag);
+    }
+    else {
+        NK_GAMEPAD_ATOMIC_AND(&gamepad->staged, ~flag);
+    }
+}
+
+/**
+ * Merge the buttons staged by nk_gamepad_button_async() into the gamepad.
+ *
+ * @internal
+ */
+static void nk_gamepad_merge_async(struct nk_gamepad* gamepad, nk_bool persistent) {
+    // Only clear the presses that were read, so one landing in between is kept for the next update.
+    unsigned int latched = NK_GAMEPAD_ATOMIC_LOAD(&gamepad->latched);
+    if (latched != 0) {
+        NK_GAMEPAD_ATOMIC_AND(&gamepad->latched, ~latched);
+    }
+    unsigned int merged = NK_GAMEPAD_ATOMIC_LOAD(&gamepad->staged) | latched;
+
+    // Persistent input sources don't clear the buttons between updates, so release the ones merged in last time.
+    if (persistent) {
+        gamepad->buttons &= ~(gamepad->merged & ~merged);
+    }
+    gamepad->merged = merged;
+    gamepad->buttons |= merged;
+}
+#endif
+
+NK_API void nk_gamepad_update(struct nk_gamepads* gamepads) {
+    if (gamepads == NULL) {
+        return;
+    }
+
+#ifdef NK_GAMEPAD_TRACE
+    gamepads->trace.frames++;
+#endif
+
+    nk_bool poll = nk_true;
+#ifdef NK_GAMEPAD_BUDGET
+    // Keep the last known state while backing off from a stalled input source.
+    if (gamepads->budget.skip > 0) {
+        gamepads->budget.skip--;
+        gamepads->budget.skipped++;
+        poll = nk_false;
+    }
+#endif
+
+    // Decided once, rather than reloading the input source for every gamepad.
+    const nk_bool clear = (poll && !gamepads->input_source.persistent) ? nk_true : nk_false;
+    for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
+        if (gamepads->gamepads[i].available == nk_false) {
+            continue;
+        }
+        gamepads->gamepads[i].buttons_prev = gamepads->gamepads[i].buttons;
+        if (clear) {
+            gamepads->gamepads[i].buttons = 0;
+        }
+    }
+
+    if (poll && gamepads->input_source.update) {
+#if defined(NK_GAMEPAD_JOURNAL) || defined(NK_GAMEPAD_BUDGET)
+        nk_gamepad_time start = nk_gamepad_now();
+#endif
+        NK_GAMEPAD_TRACE_COUNT(gamepads, backend_calls, 1);
+        NK_GAMEPAD_TRACE_BEGIN("nk_gamepad_update");
+        gamepads->input_source.update(gamepads, gamepads->input_source.user_data);
+        NK_GAMEPAD_TRACE_END("nk_gamepad_update");
+#if defined(NK_GAMEPAD_JOURNAL) || defined(NK_GAMEPAD_BUDGET)
+        nk_gamepad_time cost = nk_gamepad_now() - start;
+#endif
+#ifdef NK_GAMEPAD_JOURNAL
+        if (cost > NK_GAMEPAD_JOURNAL_SPIKE) {
+            nk_gamepad_journal_write(gamepads, -1, "nuklear_gamepad", NK_GAMEPAD_JOURNAL_LATENCY_SPIKE, (int)(cost / 1000));
+        }
+#endif
+#ifdef NK_GAMEPAD_BUDGET
+        nk_gamepad_budget_update(gamepads, cost);
+#endif
+    }
+
+#ifdef NK_GAMEPAD_THREADSAFE
+    if (poll) {
+        const nk_bool persistent = gamepads->input_source.persistent;
+        for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
+            if (gamepads->gamepads[i].available) {
+                nk_gamepad_merge_async(&gamepads->gamepads[i], persistent);
+            }
+        }
+    }
+#endif
+
+#ifdef NK_GAMEPAD_EVENTS
+    nk_gamepad_events_update(gamepads);
+#endif
+
+#ifdef NK_GAMEPAD_STATS
+    for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
+        nk_gamepad_stats_update(&gamepads->gamepads[i]);
+    }
+#endif
+
+#ifdef NK_GAMEPAD_TIMESTAMPS
+    gamepads->time = nk_gamepad_clock(gamepads);
+    for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
+        if (gamepads->gamepads[i].available) {
+            nk_gamepad_timestamps_update(&gamepads->gamepads[i], gamepads->time);
+        }
+    }
+#endif
+
+#ifdef NK_GAMEPAD_HISTORY
+    for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
+        nk_gamepad_history_update(&gamepads->gamepads[i]);
+    }
+#endif
+
+#ifdef NK_GAMEPAD_PATTERNS
+    nk_gamepad_patterns_update(gamepads);
+#endif
+
+#ifdef NK_GAMEPAD_GESTURES
+    nk_gamepad_gestures_update(gamepads);
+#endif
+
+#ifdef NK_GAMEPAD_ACTIVE
+    nk_gamepad_active_update(gamepads);
+#endif
+
+#ifdef NK_GAMEPAD_CALLBACKS
+    nk_gamepad_callbacks_update(gamepads);
+#endif
+
+#ifdef NK_GAMEPAD_TRACE
+    nk_gamepad_trace_frame(gamepads);
+#endif
+}
+
+NK_API nk_bool nk_gamepad_is_button_down(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button) {
+    if (gamepads == NULL) {
+        return nk_false;
+    }
+
+    if (num < 0) {
+        for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
+            if (gamepads->gamepads[i].available == nk_false) {
+                continue;
+            }
+
+            if ((gamepads->gamepads[i].buttons & NK_GAMEPAD_BUTTON_FLAG(button)) != 0) {
+                return nk_true;
+            }
+        }
+        return nk_false;
+    }
+
+    if (num >= NK_GAMEPAD_MAX || gamepads->gamepads[num].available == nk_false) {
+        return nk_false;
+    }
+
+    return (gamepads->gamepads[num].buttons & NK_GAMEPAD_BUTTON_FLAG(button)) != 0;
+}
+
+NK_API nk_bool nk_gamepad_is_button_pressed(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button) {
+    if (gamepads == NULL) {
+        return nk_false;
+    }
+
+    if (num < 0) {
+        for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
+            if (gamepads->gamepads[i].available == nk_false) {
+                continue;
+            }
+
+            if ((gamepads->gamepads[i].buttons_prev & NK_GAMEPAD_BUTTON_FLAG(button)) == 0 &&
+			    (gamepads->gamepads[i].buttons & NK_GAMEPAD_BUTTON_FLAG(button)) != 0) {
+                return nk_true;
+            }
+        }
+        return nk_false;
+    }
+
+    if (num >= NK_GAMEPAD_MAX || gamepads->gamepads[num].available == nk_false) {
+        return nk_false;
+    }
+
+    return ((gamepads->gamepads[num].buttons_prev & NK_GAMEPAD_BUTTON_FLAG(button)) == 0 &&
+			(gamepads->gamepads[num].buttons & NK_GAMEPAD_BUTTON_FLAG(button)) != 0);
+}
+
+NK_API nk_bool nk_gamepad_is_button_released(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button) {
+    if (gamepads == NULL) {
+        return nk_false;
+    }
+
+    if (num < 0) {
+        for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
+            if (gamepads->gamepads[i].available == nk_false) {
+                continue;
+            }
+
+            if ((gamepads->gamepads[i].buttons & NK_GAMEPAD_BUTTON_FLAG(button)) == 0 &&
+			    (gamepads->gamepads[i].buttons_prev & NK_GAMEPAD_BUTTON_FLAG(button)) != 0) {
+                return nk_true;
+            }
+        }
+        return nk_false;
+    }
+
+    if (num >= NK_GAMEPAD_MAX || gamepads->gamepads[num].available == nk_false) {
+        return nk_false;
+    }
+
+    return ((gamepads->gamepads[num].buttons & NK_GAMEPAD_BUTTON_FLAG(button)) == 0 &&
+			(gamepads->gamepads[num].buttons_prev & NK_GAMEPAD_BUTTON_FLAG(button)) != 0);
+}
+
+NK_API int nk_gamepad_count(struct nk_gamepads* gamepads) {
+    if (gamepads == NULL) {
+        return 0;
+    }
+
+    return NK_GAMEPAD_MAX;
+}
+
+NK_API const char* nk_gamepad_name(struct nk_gamepads* gamepads, int num) {
+    if (!gamepads || num < 0 || num >= NK_GAMEPAD_MAX || gamepads->gamepads[num].available == nk_false) {
+        return NULL;
+    }
+
+    if (gamepads->input_source.name) {
+        NK_GAMEPAD_TRACE_COUNT(gamepads, backend_calls, 1);
+        NK_GAMEPAD_TRACE_BEGIN("nk_gamepad_name");
+        const char* name = gamepads->input_source.name(gamepads, num, gamepads->input_source.user_data);
+        NK_GAMEPAD_TRACE_END("nk_gamepad_name");
+#ifdef NK_GAMEPAD_JOURNAL
+        nk_gamepad_journal_name(gamepads, num, name);
+#endif
+        return name;
+    } else {
+        return gamepads->gamepads[num].name;
+    }
+}
+
+NK_API struct nk_gamepad_input_source* nk_gamepad_input_source(struct nk_gamepads* gamepads) {
+    if (gamepads == NULL) {
+        return NULL;
+    }
+
+    return &gamepads->input_source;
+}
+
+NK_API nk_bool nk_gamepad_any_button_pressed(struct nk_gamepads* gamepads, int num, int* out_num, enum nk_gamepad_button* out_button) {
+    if (gamepads == NULL || num >= NK_GAMEPAD_MAX) {
+        return nk_false;
+    }
+
+    if (num < 0) {
+        for (num = 0; num < NK_GAMEPAD_MAX; num++) {
+            for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
+                if (nk_gamepad_is_button_pressed(gamepads, num, (enum nk_gamepad_button)i)) {
+                    if (out_num != NULL) {
+                        *out_num = num;
+                    }
+                    if (out_button != NULL) {
+                        *out_button = (enum nk_gamepad_button)i;
+                    }
+                    return nk_true;
+                }
+            }
+        }
+
+        return nk_false;
+    }
+
+    if (gamepads->gamepads[num].available == nk_false) {
+        return nk_false;
+    }
+
+    for (int button = NK_GAMEPAD_BUTTON_FIRST; button < NK_GAMEPAD_BUTTON_LAST; button++) {
+        if (nk_gamepad_is_button_pressed(gamepads, num, (enum nk_gamepad_button)button)) {
+            if (out_num != NULL) {
+                *out_num = num;
+            }
+            if (out_button != NULL) {
+                *out_button = (enum nk_gamepad_button)button;
+            }
+            return nk_true;
+        }
+    }
+
+    return nk_false;
+}
+
+NK_API nk_bool nk_gamepad_is_available(struct nk_gamepads* gamepads, int num) {
+    if (gamepads == NULL) {
+        return nk_false;
+    }
+
+    if (num < 0) {
+        for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
+            if (gamepads->gamepads[i].available) {
+                return nk_true;
+            }
+        }
+        return nk_false;
+    }
+
+    if (num >= NK_GAMEPAD_MAX) {
+        return nk_false;
+    }
+
+    return gamepads->gamepads[num].available;
+}
+
+NK_API nk_gamepad_time nk_gamepad_now(void) {
+#if defined(_WIN32)
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (nk_gamepad_time)(counter.QuadPart / frequency.QuadPart) * 1000000000ull +
+        (nk_gamepad_time)(counter.QuadPart % frequency.QuadPart) * 1000000000ull / (nk_gamepad_time)frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (nk_gamepad_time)now.tv_sec * 1000000000ull + (nk_gamepad_time)now.tv_nsec;
+#else
+    return (nk_gamepad_time)clock() * (1000000000ull / CLOCKS_PER_SEC);
 #endif
-#ifdef NK_GAMEPAD_GLFW
-#include "nuklear_gamepad_glfw.h"
+}
+
+NK_API void nk_gamepad_set_clock(struct nk_gamepads* gamepads, nk_gamepad_clock_fn clock, void* user_data) {
+    if (gamepads == NULL) {
+        return;
+    }
+
+    gamepads->clock = clock;
+    gamepads->clock_user_data = user_data;
+}
+
+#ifdef NK_GAMEPAD_JOURNAL
+NK_API void nk_gamepad_journal_write(struct nk_gamepads* gamepads, int num, const char* backend, enum nk_gamepad_journal_type type, int detail) {
+    if (gamepads == NULL) {
+        return;
+    }
+
+    // Claim an entry, and mark it as being written until it is filled in.
+    unsigned int index = NK_GAMEPAD_ATOMIC_FETCH_ADD(&gamepads->journal.head, 1u);
+    struct nk_gamepad_journal_entry* entry = &gamepads->journal.entries[index & (NK_GAMEPAD_JOURNAL_SIZE - 1)];
+    NK_GAMEPAD_ATOMIC_STORE(&entry->sequence, 0u);
+    // Keeps the fields below from being written before readers can see the entry is being written.
+    NK_GAMEPAD_ATOMIC_FENCE_RELEASE();
+    entry->time = nk_gamepad_now();
+    entry->num = num;
+    entry->backend = backend;
+    entry->type = type;
+    entry->detail = detail;
+    NK_GAMEPAD_ATOMIC_STORE(&entry->sequence, index + 1);
+}
+
+NK_API nk_bool nk_gamepad_journal_next(struct nk_gamepads* gamepads, unsigned int* cursor, struct nk_gamepad_journal_entry* entry) {
+    if (gamepads == NULL || cursor == NULL || entry == NULL) {
+        return nk_false;
+    }
+
+    unsigned int head = NK_GAMEPAD_ATOMIC_LOAD(&gamepads->journal.head);
+    if (head - *cursor > NK_GAMEPAD_JOURNAL_SIZE) {
+        *cursor = head - NK_GAMEPAD_JOURNAL_SIZE;
+    }
+
+    for (; *cursor != head; (*cursor)++) {
+        struct nk_gamepad_journal_entry* slot = &gamepads->journal.entries[*cursor & (NK_GAMEPAD_JOURNAL_SIZE - 1)];
+        unsigned int sequence = NK_GAMEPAD_ATOMIC_LOAD(&slot->sequence);
+        if (sequence == 0 || sequence - 1 < *cursor) {
+            // Still being written.
+            return nk_false;
+        }
+
+        *entry = *slot;
+        // Keeps the copy from being read after the sequence is checked again.
+        NK_GAMEPAD_ATOMIC_FENCE_ACQUIRE();
+        if (sequence == *cursor + 1 && NK_GAMEPAD_ATOMIC_LOAD(&slot->sequence) == sequence) {
+            (*cursor)++;
+            return nk_true;
+        }
+
+        // Overwritten by a newer event, so it is lost.
+    }
+
+    return nk_false;
+}
+
+NK_API const char* nk_gamepad_journal_type_name(enum nk_gamepad_journal_type type) {
+    switch (type) {
+        case NK_GAMEPAD_JOURNAL_CONNECTED: return "connected";
+        case NK_GAMEPAD_JOURNAL_DISCONNECTED: return "disconnected";
+        case NK_GAMEPAD_JOURNAL_OPEN_FAILED: return "open failed";
+        case NK_GAMEPAD_JOURNAL_NAME_CHANGED: return "name changed";
+        case NK_GAMEPAD_JOURNAL_LATENCY_SPIKE: return "latency spike";
+        case NK_GAMEPAD_JOURNAL_STALL: return "stall";
+        default: return "unknown";
+    }
+}
 #endif
-#ifdef NK_GAMEPAD_RAYLIB
-#include "nuklear_gamepad_raylib.h"
+
+#ifdef NK_GAMEPAD_BUDGET
+NK_API void nk_gamepad_set_budget(struct nk_gamepads* gamepads, nk_gamepad_time budget) {
+    if (gamepads == NULL) {
+        return;
+    }
+
+    gamepads->budget.limit = budget;
+    gamepads->budget.skip = 0;
+    gamepads->budget.backoff = 0;
+}
 #endif
-#ifdef NK_GAMEPAD_PNTR
-#include "nuklear_gamepad_pntr.h"
+
+/**
+ * Check a button in an array of per gamepad masks, for one gamepad or any of them.
+ *
+ * @internal
+ */
+static nk_bool nk_gamepad_mask_check(const unsigned int* masks, int num, enum nk_gamepad_button button) {
+    if (button < NK_GAMEPAD_BUTTON_FIRST || button >= NK_GAMEPAD_BUTTON_LAST || num >= NK_GAMEPAD_MAX) {
+        return nk_false;
+    }
+
+    const unsigned int flag = (unsigned int)NK_GAMEPAD_BUTTON_FLAG(button);
+    if (num >= 0) {
+        return (masks[num] & flag) ? nk_true : nk_false;
+    }
+
+    for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
+        if (masks[i] & flag) {
+            return nk_true;
+        }
+    }
+    return nk_false;
+}
+
+#ifdef NK_GAMEPAD_EVENTS
+NK_API nk_bool nk_gamepad_event_next(struct nk_gamepads* gamepads, unsigned int* cursor, struct nk_gamepad_event* event) {
+    if (gamepads == NULL || cursor == NULL || event == NULL) {
+        return nk_false;
+    }
+
+    unsigned int head = gamepads->events.head;
+    if (head - *cursor > NK_GAMEPAD_EVENTS_SIZE) {
+        *cursor = head - NK_GAMEPAD_EVENTS_SIZE;
+    }
+    if (*cursor == head) {
+        return nk_false;
+    }
+
+    *event = gamepads->events.entries[(*cursor)++ & (NK_GAMEPAD_EVENTS_SIZE - 1)];
+    return nk_true;
+}
+
+/**
+ * Take in the events from the cursor up to the given time, adding up the presses and releases of each gamepad. The
+ * buttons of each gamepad are kept up to date too, unless they are NULL.
+ *
+ * @internal
+ */
+static void nk_gamepad_events_read(struct nk_gamepads* gamepads, unsigned int* cursor, nk_gamepad_time until,
+    unsigned int* buttons, unsigned int* pressed, unsigned int* released)
+{
+    struct nk_gamepad_event event;
+    unsigned int next = *cursor;
+    while (nk_gamepad_event_next(gamepads, &next, &event) && event.time <= until) {
+        pressed[event.num] |= event.changed & event.buttons;
+        released[event.num] |= event.changed & ~event.buttons;
+        if (buttons != NULL) {
+            buttons[event.num] = event.buttons;
+        }
+        *cursor = next;
+    }
+}
+
+NK_API void nk_gamepad_ticker_init(struct nk_gamepad_ticker* ticker, struct nk_gamepads* gamepads, nk_gamepad_time step) {
+    if (ticker == NULL) {
+        return;
+    }
+
+    nk_zero(ticker, sizeof(struct nk_gamepad_ticker));
+    // Without a step, ticking until nk_gamepad_tick() returns false would never end.
+    if (gamepads == NULL || step == 0) {
+        return;
+    }
+
+    // Start from the current state, and only take in events from now on.
+    ticker->gamepads = gamepads;
+    ticker->step = step;
+    ticker->time = nk_gamepad_clock(gamepads);
+    ticker->cursor = gamepads->events.head;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        ticker->buttons[num] = gamepads->events.buttons[num];
+    }
+}
+
+NK_API nk_bool nk_gamepad_tick(struct nk_gamepad_ticker* ticker, nk_gamepad_time now) {
+    if (ticker == NULL || ticker->gamepads == NULL || now < ticker->time || now - ticker->time < ticker->step) {
+        return nk_false;
+    }
+
+    ticker->time += ticker->step;
+    nk_zero(ticker->pressed, sizeof(ticker->pressed));
+    nk_zero(ticker->released, sizeof(ticker->released));
+
+    // Take in the events up to the end of the tick, and leave the rest for the next ones.
+    nk_gamepad_events_read(ticker->gamepads, &ticker->cursor, ticker->time, ticker->buttons, ticker->pressed, ticker->released);
+    return nk_true;
+}
+
+NK_API nk_bool nk_gamepad_tick_is_button_down(struct nk_gamepad_ticker* ticker, int num, enum nk_gamepad_button button) {
+    return ticker != NULL && nk_gamepad_mask_check(ticker->buttons, num, button);
+}
+
+NK_API nk_bool nk_gamepad_tick_is_button_pressed(struct nk_gamepad_ticker* ticker, int num, enum nk_gamepad_button button) {
+    return ticker != NULL && nk_gamepad_mask_check(ticker->pressed, num, button);
+}
+
+NK_API nk_bool nk_gamepad_tick_is_button_released(struct nk_gamepad_ticker* ticker, int num, enum nk_gamepad_button button) {
+    return ticker != NULL && nk_gamepad_mask_check(ticker->released, num, button);
+}
 #endif
-#ifdef NK_GAMEPAD_KEYBOARD
-#include "nuklear_gamepad_keyboard.h"
+
+NK_API void nk_gamepad_consumer_init(struct nk_gamepad_consumer* consumer, struct nk_gamepads* gamepads) {
+    if (consumer == NULL) {
+        return;
+    }
+
+    nk_zero(consumer, sizeof(struct nk_gamepad_consumer));
+    if (gamepads == NULL) {
+        return;
+    }
+
+    consumer->gamepads = gamepads;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        consumer->buttons[num] = gamepads->gamepads[num].available ? gamepads->gamepads[num].buttons : 0;
+    }
+#ifdef NK_GAMEPAD_EVENTS
+    consumer->cursor = gamepads->events.head;
 #endif
+}
+
+NK_API void nk_gamepad_consumer_update(struct nk_gamepad_consumer* consumer) {
+    if (consumer == NULL || consumer->gamepads == NULL) {
+        return;
+    }
 
-#ifdef __cplusplus
-extern "C" {
+    nk_zero(consumer->pressed, sizeof(consumer->pressed));
+    nk_zero(consumer->released, sizeof(consumer->released));
+
+#ifdef NK_GAMEPAD_EVENTS
+    // The events catch presses that didn't last until now. The state is still compared below, in case the ring was
+    // overrun before the consumer got to it.
+    nk_gamepad_events_read(consumer->gamepads, &consumer->cursor, (nk_gamepad_time)-1, NULL, consumer->pressed, consumer->released);
 #endif
 
-#ifndef NK_GAMEPAD_DEFAULT_INPUT_SOURCE
-static struct nk_gamepad_input_source nk_gamepad_none_input_source(void* user_data) {
-    struct nk_gamepad_input_source source = {
-        .user_data = user_data
-    };
-    return source;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        const struct nk_gamepad* gamepad = &consumer->gamepads->gamepads[num];
+        unsigned int now = gamepad->available ? gamepad->buttons : 0;
+        consumer->pressed[num] |= now & ~consumer->buttons[num];
+        consumer->released[num] |= consumer->buttons[num] & ~now;
+        consumer->buttons[num] = now;
+    }
 }
 
-#define NK_GAMEPAD_DEFAULT_INPUT_SOURCE nk_gamepad_none_input_source
-#endif
+NK_API nk_bool nk_gamepad_consumer_is_button_down(struct nk_gamepad_consumer* consumer, int num, enum nk_gamepad_button button) {
+    return consumer != NULL && nk_gamepad_mask_check(consumer->buttons, num, button);
+}
 
-NK_API nk_bool nk_gamepad_init(struct nk_gamepads* gamepads, struct nk_context* ctx, void* user_data) {
-    return nk_gamepad_init_with_source(gamepads, ctx, NK_GAMEPAD_DEFAULT_INPUT_SOURCE(user_data));
+NK_API nk_bool nk_gamepad_consumer_is_button_pressed(struct nk_gamepad_consumer* consumer, int num, enum nk_gamepad_button button) {
+    return consumer != NULL && nk_gamepad_mask_check(consumer->pressed, num, button);
 }
 
-NK_API nk_bool nk_gamepad_init_with_source(struct nk_gamepads* gamepads, struct nk_context* ctx, struct nk_gamepad_input_source input_source) {
-    if (gamepads == NULL) {
-        return nk_false;
+NK_API nk_bool nk_gamepad_consumer_is_button_released(struct nk_gamepad_consumer* consumer, int num, enum nk_gamepad_button button) {
+    return consumer != NULL && nk_gamepad_mask_check(consumer->released, num, button);
+}
+
+#ifdef NK_GAMEPAD_TIMESTAMPS
+NK_API nk_gamepad_time nk_gamepad_button_held_time(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button) {
+    if (gamepads == NULL || num < 0 || num >= NK_GAMEPAD_MAX || button < NK_GAMEPAD_BUTTON_FIRST || button >= NK_GAMEPAD_BUTTON_LAST) {
+        return 0;
     }
 
-    // Initialize the gamepads as a default state.
-    nk_zero(gamepads, sizeof(struct nk_gamepads));
-    gamepads->ctx = ctx;
-    gamepads->input_source = input_source;
+    const struct nk_gamepad* gamepad = &gamepads->gamepads[num];
+    if (gamepad->available == nk_false || (gamepad->buttons & NK_GAMEPAD_BUTTON_FLAG(button)) == 0) {
+        return 0;
+    }
+    return gamepads->time - gamepad->pressed_at[button];
+}
 
-    // Set the default state for all gamepads.
-    for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
-        // Available
-        gamepads->gamepads[i].available = nk_true;
+NK_API nk_gamepad_time nk_gamepad_button_released_time(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button) {
+    if (gamepads == NULL || num < 0 || num >= NK_GAMEPAD_MAX || button < NK_GAMEPAD_BUTTON_FIRST || button >= NK_GAMEPAD_BUTTON_LAST) {
+        return 0;
+    }
 
-        // Name
-        int j;
-        const char* name_prefix = NK_GAMEPAD_NAME_PREFIX;
-        for (j = 0; j < nk_strlen(name_prefix); j++) {
-            gamepads->gamepads[i].name[j] = name_prefix[j];
+    const struct nk_gamepad* gamepad = &gamepads->gamepads[num];
+    if (gamepad->available == nk_false || (gamepad->buttons & NK_GAMEPAD_BUTTON_FLAG(button)) != 0 || (gamepad->was_released & NK_GAMEPAD_BUTTON_FLAG(button)) == 0) {
+        return 0;
+    }
+    return gamepads->time - gamepad->released_at[button];
+}
+#endif
+
+#ifdef NK_GAMEPAD_HISTORY
+NK_API nk_bool nk_gamepad_is_button_pressed_within(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, int updates) {
+    if (gamepads == NULL || num >= NK_GAMEPAD_MAX || button < NK_GAMEPAD_BUTTON_FIRST || button >= NK_GAMEPAD_BUTTON_LAST || updates < 1 || updates > 63) {
+        return nk_false;
+    }
+
+    for (int i = (num < 0) ? 0 : num; i < ((num < 0) ? NK_GAMEPAD_MAX : num + 1); i++) {
+        if (gamepads->gamepads[i].available && nk_gamepad_history_presses(&gamepads->gamepads[i], button, updates) != 0) {
+            return nk_true;
         }
+    }
+    return nk_false;
+}
 
-        // Add the # of the controller to the name.
-        nk_itoa(&gamepads->gamepads[i].name[j], (long)(i + 1));
+NK_API nk_bool nk_gamepad_is_button_held_for(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, int updates) {
+    if (gamepads == NULL || num >= NK_GAMEPAD_MAX || button < NK_GAMEPAD_BUTTON_FIRST || button >= NK_GAMEPAD_BUTTON_LAST || updates < 1 || updates > 64) {
+        return nk_false;
     }
 
-        if (input_source.init && input_source.init(gamepads, input_source.user_data) == nk_false) {
-            return nk_false;
+    const unsigned long long window = (updates == 64) ? ~0ULL : (1ULL << updates) - 1;
+    for (int i = (num < 0) ? 0 : num; i < ((num < 0) ? NK_GAMEPAD_MAX : num + 1); i++) {
+        if (gamepads->gamepads[i].available && (gamepads->gamepads[i].history[button] & window) == window) {
+            return nk_true;
         }
+    }
+    return nk_false;
+}
 
-    // Set all the states as the same as their previous states so that they don't trigger any events.
-    for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
-        gamepads->gamepads[i].buttons_prev = gamepads->gamepads[i].buttons;
+NK_API int nk_gamepad_button_taps(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, int updates) {
+    if (gamepads == NULL || num < 0 || num >= NK_GAMEPAD_MAX || gamepads->gamepads[num].available == nk_false ||
+        button < NK_GAMEPAD_BUTTON_FIRST || button >= NK_GAMEPAD_BUTTON_LAST || updates < 1 || updates > 63) {
+        return 0;
     }
 
-    return nk_true;
+    unsigned long long presses = nk_gamepad_history_presses(&gamepads->gamepads[num], button, updates);
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(presses);
+#else
+    int count = 0;
+    for (; presses; presses &= presses - 1) {
+        count++;
+    }
+    return count;
+#endif
 }
+#endif
 
-NK_API void nk_gamepad_free(struct nk_gamepads* gamepads) {
-    if (gamepads == NULL) {
-        return;
+#ifdef NK_GAMEPAD_CALLBACKS
+NK_API int nk_gamepad_add_callback(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, nk_gamepad_button_fn callback, void* user_data) {
+    if (gamepads == NULL || callback == NULL || num >= NK_GAMEPAD_MAX || button < NK_GAMEPAD_BUTTON_INVALID || button >= NK_GAMEPAD_BUTTON_LAST) {
+        return -1;
     }
 
-    // Tell the runner that we are freeing the gamepads.
-    if (gamepads->input_source.free) {
-        gamepads->input_source.free(gamepads, gamepads->input_source.user_data);
+    for (int i = 0; i < NK_GAMEPAD_CALLBACKS_MAX; i++) {
+        struct nk_gamepad_callback* entry = &gamepads->callbacks.entries[i];
+        if (entry->callback != NULL) {
+            continue;
+        }
+
+        entry->callback = callback;
+        entry->user_data = user_data;
+        entry->num = (num < 0) ? -1 : num;
+        entry->buttons = (button == NK_GAMEPAD_BUTTON_INVALID) ? NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST) - 1 : NK_GAMEPAD_BUTTON_FLAG(button);
+        nk_gamepad_callbacks_watch(gamepads);
+        return i;
     }
 
-    // Reset the default state of the gamepad data.
-    nk_zero(gamepads, sizeof(struct nk_gamepads));
+    return -1;
 }
 
-NK_API void nk_gamepad_button(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, nk_bool down) {
-    if (gamepads == NULL || num < 0 || num >= NK_GAMEPAD_MAX || gamepads->gamepads[num].available == nk_false) {
+NK_API void nk_gamepad_remove_callback(struct nk_gamepads* gamepads, int handle) {
+    if (gamepads == NULL || handle < 0 || handle >= NK_GAMEPAD_CALLBACKS_MAX) {
         return;
     }
 
-    if (down) {
-        gamepads->gamepads[num].buttons |= NK_GAMEPAD_BUTTON_FLAG(button);
-    }
-    else {
-        gamepads->gamepads[num].buttons &= ~NK_GAMEPAD_BUTTON_FLAG(button);
-    }
+    nk_zero(&gamepads->callbacks.entries[handle], sizeof(struct nk_gamepad_callback));
+    nk_gamepad_callbacks_watch(gamepads);
 }
+#endif
 
-NK_API void nk_gamepad_update(struct nk_gamepads* gamepads) {
-    if (gamepads == NULL) {
-        return;
+#ifdef NK_GAMEPAD_PATTERNS
+NK_API int nk_gamepad_add_pattern(struct nk_gamepads* gamepads, const unsigned int* steps, int length, nk_gamepad_time timeout) {
+    if (gamepads == NULL || steps == NULL || length < 1 || length > NK_GAMEPAD_PATTERNS_LENGTH) {
+        return -1;
+    }
+    for (int step = 0; step < length; step++) {
+        if (steps[step] == 0 || (steps[step] & ~(NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST) - 1)) != 0) {
+            return -1;
+        }
     }
 
-    for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
-        if (gamepads->gamepads[i].available == nk_false) {
+    for (int i = 0; i < NK_GAMEPAD_PATTERNS_MAX; i++) {
+        struct nk_gamepad_pattern* entry = &gamepads->patterns.entries[i];
+        if (entry->length != 0) {
             continue;
         }
-        gamepads->gamepads[i].buttons_prev = gamepads->gamepads[i].buttons;
-        gamepads->gamepads[i].buttons = 0;
+
+        for (int step = 0; step < length; step++) {
+            entry->steps[step] = steps[step];
+        }
+        entry->length = length;
+        entry->timeout = timeout;
+
+        // Take it back out if the table can't hold it.
+        if (nk_gamepad_patterns_compile(&gamepads->patterns) == nk_false) {
+            nk_gamepad_remove_pattern(gamepads, i);
+            return -1;
+        }
+        nk_zero(gamepads->patterns.state, sizeof(gamepads->patterns.state));
+        return i;
     }
 
-    if (gamepads->input_source.update) {
-        gamepads->input_source.update(gamepads, gamepads->input_source.user_data);
+    return -1;
+}
+
+NK_API void nk_gamepad_remove_pattern(struct nk_gamepads* gamepads, int handle) {
+    if (gamepads == NULL || handle < 0 || handle >= NK_GAMEPAD_PATTERNS_MAX) {
+        return;
+    }
+
+    nk_zero(&gamepads->patterns.entries[handle], sizeof(struct nk_gamepad_pattern));
+    nk_gamepad_patterns_compile(&gamepads->patterns);
+    nk_zero(gamepads->patterns.state, sizeof(gamepads->patterns.state));
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        gamepads->patterns.matched[num] &= ~(1u << handle);
     }
 }
 
-NK_API nk_bool nk_gamepad_is_button_down(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button) {
-    if (gamepads == NULL) {
+NK_API nk_bool nk_gamepad_is_pattern_matched(struct nk_gamepads* gamepads, int num, int handle) {
+    if (gamepads == NULL || num >= NK_GAMEPAD_MAX || handle < 0 || handle >= NK_GAMEPAD_PATTERNS_MAX) {
         return nk_false;
     }
 
-    if (num < 0) {
-        for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
-            if (gamepads->gamepads[i].available == nk_false) {
-                continue;
-            }
-
-            if ((gamepads->gamepads[i].buttons & NK_GAMEPAD_BUTTON_FLAG(button)) != 0) {
-                return nk_true;
-            }
+    for (int i = (num < 0) ? 0 : num; i < ((num < 0) ? NK_GAMEPAD_MAX : num + 1); i++) {
+        if (gamepads->patterns.matched[i] & (1u << handle)) {
+            return nk_true;
         }
-        return nk_false;
     }
+    return nk_false;
+}
+#endif
 
-    if (num >= NK_GAMEPAD_MAX || gamepads->gamepads[num].available == nk_false) {
+#ifdef NK_GAMEPAD_GESTURES
+NK_API nk_bool nk_gamepad_is_button_double_tapped(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button) {
+    if (gamepads == NULL) {
         return nk_false;
     }
 
-    return (gamepads->gamepads[num].buttons & NK_GAMEPAD_BUTTON_FLAG(button)) != 0;
+    return nk_gamepad_mask_check(gamepads->gestures.double_tapped, num, button);
 }
 
-NK_API nk_bool nk_gamepad_is_button_pressed(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button) {
+NK_API nk_bool nk_gamepad_is_button_long_pressed(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button) {
     if (gamepads == NULL) {
         return nk_false;
     }
 
-    if (num < 0) {
-        for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
-            if (gamepads->gamepads[i].available == nk_false) {
-                continue;
-            }
+    return nk_gamepad_mask_check(gamepads->gestures.long_pressed, num, button);
+}
 
-            if ((gamepads->gamepads[i].buttons_prev & NK_GAMEPAD_BUTTON_FLAG(button)) == 0 &&
-			    (gamepads->gamepads[i].buttons & NK_GAMEPAD_BUTTON_FLAG(button)) != 0) {
-                return nk_true;
-            }
-        }
+NK_API nk_bool nk_gamepad_is_button_repeated(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button) {
+    if (gamepads == NULL) {
         return nk_false;
     }
 
-    if (num >= NK_GAMEPAD_MAX || gamepads->gamepads[num].available == nk_false) {
+    return nk_gamepad_mask_check(gamepads->gestures.repeated, num, button);
+}
+#endif
+
+#ifdef NK_GAMEPAD_ACTIONS
+NK_API nk_bool nk_gamepad_action_set_init(struct nk_gamepad_action_set* set, const char* const* names, int count) {
+    if (set == NULL || names == NULL || count < 0 || count > NK_GAMEPAD_ACTIONS_MAX) {
         return nk_false;
     }
+    for (int action = 0; action < count; action++) {
+        if (names[action] == NULL) {
+            return nk_false;
+        }
+    }
 
-    return ((gamepads->gamepads[num].buttons_prev & NK_GAMEPAD_BUTTON_FLAG(button)) == 0 &&
-			(gamepads->gamepads[num].buttons & NK_GAMEPAD_BUTTON_FLAG(button)) != 0);
+    nk_zero(set, sizeof(struct nk_gamepad_action_set));
+    set->names = names;
+    set->count = count;
+    return nk_true;
 }
 
-NK_API nk_bool nk_gamepad_is_button_released(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button) {
-    if (gamepads == NULL) {
-        return nk_false;
+NK_API int nk_gamepad_action_find(const struct nk_gamepad_action_set* set, const char* name) {
+    if (set == NULL || name == NULL) {
+        return -1;
     }
 
-    if (num < 0) {
-        for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
-            if (gamepads->gamepads[i].available == nk_false) {
-                continue;
-            }
-
-            if ((gamepads->gamepads[i].buttons & NK_GAMEPAD_BUTTON_FLAG(button)) == 0 &&
-			    (gamepads->gamepads[i].buttons_prev & NK_GAMEPAD_BUTTON_FLAG(button)) != 0) {
-                return nk_true;
-            }
+    for (int action = 0; action < set->count; action++) {
+        const char* a = set->names[action];
+        const char* b = name;
+        while (*a != '\0' && *a == *b) {
+            a++;
+            b++;
+        }
+        if (*a == *b) {
+            return action;
         }
-        return nk_false;
     }
+    return -1;
+}
 
-    if (num >= NK_GAMEPAD_MAX || gamepads->gamepads[num].available == nk_false) {
-        return nk_false;
+NK_API void nk_gamepad_action_bind(struct nk_gamepad_action_set* set, int action, int num, enum nk_gamepad_button button) {
+    if (set == NULL || action < 0 || action >= set->count || num >= NK_GAMEPAD_MAX || button < NK_GAMEPAD_BUTTON_FIRST || button >= NK_GAMEPAD_BUTTON_LAST) {
+        return;
     }
 
-    return ((gamepads->gamepads[num].buttons & NK_GAMEPAD_BUTTON_FLAG(button)) == 0 &&
-			(gamepads->gamepads[num].buttons_prev & NK_GAMEPAD_BUTTON_FLAG(button)) != 0);
+    for (int i = (num < 0) ? 0 : num; i < ((num < 0) ? NK_GAMEPAD_MAX : num + 1); i++) {
+        set->masks[action][i] |= NK_GAMEPAD_BUTTON_FLAG(button);
+    }
 }
 
-NK_API int nk_gamepad_count(struct nk_gamepads* gamepads) {
-    if (gamepads == NULL) {
-        return 0;
+NK_API void nk_gamepad_action_unbind(struct nk_gamepad_action_set* set, int action, int num, enum nk_gamepad_button button) {
+    if (set == NULL || action < 0 || action >= set->count || num >= NK_GAMEPAD_MAX || button < NK_GAMEPAD_BUTTON_INVALID || button >= NK_GAMEPAD_BUTTON_LAST) {
+        return;
     }
 
-    return NK_GAMEPAD_MAX;
+    unsigned int flags = (button == NK_GAMEPAD_BUTTON_INVALID) ? NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST) - 1 : NK_GAMEPAD_BUTTON_FLAG(button);
+    for (int i = (num < 0) ? 0 : num; i < ((num < 0) ? NK_GAMEPAD_MAX : num + 1); i++) {
+        set->masks[action][i] &= ~flags;
+    }
 }
 
-NK_API const char* nk_gamepad_name(struct nk_gamepads* gamepads, int num) {
-    if (!gamepads || num < 0 || num >= NK_GAMEPAD_MAX || gamepads->gamepads[num].available == nk_false) {
-        return NULL;
+NK_API void nk_gamepad_set_action_set(struct nk_gamepads* gamepads, const struct nk_gamepad_action_set* set) {
+    if (gamepads == NULL) {
+        return;
     }
 
-    if (gamepads->input_source.name) {
-        return gamepads->input_source.name(gamepads, num, gamepads->input_source.user_data);
-    } else {
-        return gamepads->gamepads[num].name;
-    }
+    gamepads->actions = set;
 }
 
-NK_API struct nk_gamepad_input_source* nk_gamepad_input_source(struct nk_gamepads* gamepads) {
-    if (gamepads == NULL) {
+/**
+ * Get the buttons bound to an action for each gamepad in the action set in use, or NULL if there are none.
+ *
+ * @internal
+ */
+static const unsigned int* nk_gamepad_action_masks(struct nk_gamepads* gamepads, int num, int action) {
+    if (gamepads == NULL || gamepads->actions == NULL || num >= NK_GAMEPAD_MAX || action < 0 || action >= gamepads->actions->count) {
         return NULL;
     }
 
-    return &gamepads->input_source;
+    return gamepads->actions->masks[action];
 }
 
-NK_API nk_bool nk_gamepad_any_button_pressed(struct nk_gamepads* gamepads, int num, int* out_num, enum nk_gamepad_button* out_button) {
-    if (gamepads == NULL || num >= NK_GAMEPAD_MAX) {
+NK_API nk_bool nk_gamepad_is_action_down(struct nk_gamepads* gamepads, int num, int action) {
+    const unsigned int* masks = nk_gamepad_action_masks(gamepads, num, action);
+    if (masks == NULL) {
         return nk_false;
     }
 
-    if (num < 0) {
-        for (num = 0; num < NK_GAMEPAD_MAX; num++) {
-            for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
-                if (nk_gamepad_is_button_pressed(gamepads, num, (enum nk_gamepad_button)i)) {
-                    if (out_num != NULL) {
-                        *out_num = num;
-                    }
-                    if (out_button != NULL) {
-                        *out_button = (enum nk_gamepad_button)i;
-                    }
-                    return nk_true;
-                }
-            }
+    for (int i = (num < 0) ? 0 : num; i < ((num < 0) ? NK_GAMEPAD_MAX : num + 1); i++) {
+        const struct nk_gamepad* gamepad = &gamepads->gamepads[i];
+        if (gamepad->available && (gamepad->buttons & masks[i]) != 0) {
+            return nk_true;
         }
+    }
+    return nk_false;
+}
 
+NK_API nk_bool nk_gamepad_is_action_pressed(struct nk_gamepads* gamepads, int num, int action) {
+    const unsigned int* masks = nk_gamepad_action_masks(gamepads, num, action);
+    if (masks == NULL) {
         return nk_false;
     }
 
-    if (gamepads->gamepads[num].available == nk_false) {
+    for (int i = (num < 0) ? 0 : num; i < ((num < 0) ? NK_GAMEPAD_MAX : num + 1); i++) {
+        const struct nk_gamepad* gamepad = &gamepads->gamepads[i];
+        if (gamepad->available && (gamepad->buttons & masks[i]) != 0 && (gamepad->buttons_prev & masks[i]) == 0) {
+            return nk_true;
+        }
+    }
+    return nk_false;
+}
+
+NK_API nk_bool nk_gamepad_is_action_released(struct nk_gamepads* gamepads, int num, int action) {
+    const unsigned int* masks = nk_gamepad_action_masks(gamepads, num, action);
+    if (masks == NULL) {
         return nk_false;
     }
 
-    for (int button = NK_GAMEPAD_BUTTON_FIRST; button < NK_GAMEPAD_BUTTON_LAST; button++) {
-        if (nk_gamepad_is_button_pressed(gamepads, num, (enum nk_gamepad_button)button)) {
-            if (out_num != NULL) {
-                *out_num = num;
-            }
-            if (out_button != NULL) {
-                *out_button = (enum nk_gamepad_button)button;
-            }
+    for (int i = (num < 0) ? 0 : num; i < ((num < 0) ? NK_GAMEPAD_MAX : num + 1); i++) {
+        const struct nk_gamepad* gamepad = &gamepads->gamepads[i];
+        if (gamepad->available && (gamepad->buttons & masks[i]) == 0 && (gamepad->buttons_prev & masks[i]) != 0) {
             return nk_true;
         }
     }
-
     return nk_false;
 }
+#endif
 
-NK_API nk_bool nk_gamepad_is_available(struct nk_gamepads* gamepads, int num) {
+#ifdef NK_GAMEPAD_ACTIVE
+NK_API int nk_gamepad_last_active(struct nk_gamepads* gamepads, nk_gamepad_time* time) {
     if (gamepads == NULL) {
-        return nk_false;
+        return -1;
     }
 
-    if (num < 0) {
-        for (int i = 0; i < NK_GAMEPAD_MAX; i++) {
-            if (gamepads->gamepads[i].available) {
-                return nk_true;
-            }
-        }
-        return nk_false;
+    if (time != NULL) {
+        *time = gamepads->active.time;
     }
+    return gamepads->active.num;
+}
 
-    if (num >= NK_GAMEPAD_MAX) {
+NK_API nk_bool nk_gamepad_active_changed(struct nk_gamepads* gamepads) {
+    if (gamepads == NULL) {
         return nk_false;
     }
 
-    return gamepads->gamepads[num].available;
+    return gamepads->active.changed;
+}
+#endif
+
+#ifdef NK_GAMEPAD_STATS
+NK_API const struct nk_gamepad_stats* nk_gamepad_stats(struct nk_gamepads* gamepads, int num) {
+    if (gamepads == NULL || num < 0 || num >= NK_GAMEPAD_MAX) {
+        return NULL;
+    }
+
+    return &gamepads->gamepads[num].stats;
 }
 
+NK_API void nk_gamepad_stats_reset(struct nk_gamepads* gamepads, int num) {
+    if (gamepads == NULL || num >= NK_GAMEPAD_MAX) {
+        return;
+    }
+
+    for (int i = (num < 0) ? 0 : num; i <= ((num < 0) ? NK_GAMEPAD_MAX - 1 : num); i++) {
+        nk_bool was_available = gamepads->gamepads[i].stats.was_available;
+        nk_zero(&gamepads->gamepads[i].stats, sizeof(struct nk_gamepad_stats));
+        gamepads->gamepads[i].stats.was_available = was_available;
+    }
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
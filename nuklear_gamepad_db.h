@@ -0,0 +1,594 @@
+#ifndef NUKLEAR_GAMEPAD_DB_H__
+#define NUKLEAR_GAMEPAD_DB_H__
+
+#include <stddef.h>
+
+#ifndef NK_GAMEPAD_DB_PLATFORM
+/**
+ * The platform name used to pick between entries in the database that share a GUID.
+ */
+#if defined(__ANDROID__)
+    #define NK_GAMEPAD_DB_PLATFORM "Android"
+#elif defined(_WIN32)
+    #define NK_GAMEPAD_DB_PLATFORM "Windows"
+#elif defined(__APPLE__)
+    #include <TargetConditionals.h>
+    #if TARGET_OS_IPHONE
+        #define NK_GAMEPAD_DB_PLATFORM "iOS"
+    #else
+        #define NK_GAMEPAD_DB_PLATFORM "Mac OS X"
+    #endif
+#else
+    #define NK_GAMEPAD_DB_PLATFORM "Linux"
+#endif
+#endif  // NK_GAMEPAD_DB_PLATFORM
+
+#ifndef NK_GAMEPAD_DB_AXIS_THRESHOLD
+/**
+ * How far an axis has to move, from 0 to 1, before an axis bound to a button counts as pressed.
+ */
+#define NK_GAMEPAD_DB_AXIS_THRESHOLD 0.5f
+#endif  // NK_GAMEPAD_DB_AXIS_THRESHOLD
+
+enum nk_gamepad_db_binding_type {
+    NK_GAMEPAD_DB_BINDING_NONE = 0,
+    NK_GAMEPAD_DB_BINDING_BUTTON,
+    NK_GAMEPAD_DB_BINDING_AXIS,
+    NK_GAMEPAD_DB_BINDING_HAT
+};
+
+/**
+ * Where a gamepad button comes from on the raw device.
+ */
+struct nk_gamepad_db_binding {
+    enum nk_gamepad_db_binding_type type;
+    int index; /** The device button, axis or hat index. */
+    int axis_direction; /** For axes: 1 for the positive half, -1 for the negative half, 0 for the whole axis. */
+    nk_bool axis_inverted; /** For axes: whether the axis is flipped. */
+    unsigned int hat_mask; /** For hats: the SDL hat bit, 1 up, 2 right, 4 down and 8 left. */
+};
+
+/**
+ * A parsed mapping for one device.
+ */
+struct nk_gamepad_db_mapping {
+    char guid[33];
+    char name[NK_GAMEPAD_NAME_SIZE];
+    struct nk_gamepad_db_binding buttons[NK_GAMEPAD_BUTTON_LAST];
+};
+
+/**
+ * An index entry, pointing at a line of the database.
+ *
+ * @internal
+ */
+struct nk_gamepad_db_entry {
+    unsigned int hash;
+    unsigned int offset; /** Offset of the line, plus one. Zero marks an empty slot. */
+};
+
+/**
+ * An SDL_GameControllerDB (gamecontrollerdb.txt) mapping database.
+ *
+ * Lines are indexed by GUID when loaded, and only parsed when looked up with nk_gamepad_db_find().
+ */
+struct nk_gamepad_db {
+    const char* data;
+    size_t size;
+    struct nk_gamepad_db_entry* entries;
+    unsigned int capacity;
+    unsigned int count;
+    void* mapped; /** Memory owned by the database, either mapped or read from a file. */
+    size_t mapped_size;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Index a mapping database that is already in memory. The data is not copied, and must outlive the database.
+ *
+ * @param db The database to load into.
+ * @param data The contents of gamecontrollerdb.txt.
+ * @param size The size of the data in bytes.
+ *
+ * @return True if the database was indexed, false otherwise.
+ */
+NK_API nk_bool nk_gamepad_db_load_memory(struct nk_gamepad_db* db, const char* data, size_t size);
+
+/**
+ * Map a gamecontrollerdb.txt file into memory and index it.
+ *
+ * @param db The database to load into.
+ * @param path The path to the file.
+ *
+ * @return True if the database was loaded, false otherwise.
+ */
+NK_API nk_bool nk_gamepad_db_load_file(struct nk_gamepad_db* db, const char* path);
+
+/**
+ * Free the index, and unmap the file if it was loaded with nk_gamepad_db_load_file().
+ */
+NK_API void nk_gamepad_db_free(struct nk_gamepad_db* db);
+
+/**
+ * Find and parse the mapping for the given device GUID.
+ *
+ * When the same GUID is listed more than once, the last entry for the current platform wins.
+ *
+ * @param db The database.
+ * @param guid The 32 character hexadecimal SDL GUID of the device.
+ * @param mapping Where to store the parsed mapping.
+ *
+ * @return True if a mapping was found, false otherwise.
+ *
+ * @see nk_gamepad_db_guid()
+ */
+NK_API nk_bool nk_gamepad_db_find(struct nk_gamepad_db* db, const char* guid, struct nk_gamepad_db_mapping* mapping);
+
+/**
+ * Build the SDL GUID string for a device from its bus type, vendor, product and version.
+ *
+ * @param guid Where to write the 32 character GUID, plus a NULL terminator.
+ */
+NK_API void nk_gamepad_db_guid(char guid[33], unsigned short bus, unsigned short vendor, unsigned short product, unsigned short version);
+
+/**
+ * Convert raw device state into a button mask, using the given mapping.
+ *
+ * @param mapping The mapping for the device.
+ * @param buttons The device buttons, non-zero when pressed.
+ * @param num_buttons The amount of device buttons.
+ * @param axes The device axes, from -1 to 1.
+ * @param num_axes The amount of device axes.
+ * @param hats The device hats, as SDL hat bits.
+ * @param num_hats The amount of device hats.
+ *
+ * @return A mask of NK_GAMEPAD_BUTTON_FLAG() values.
+ */
+NK_API unsigned int nk_gamepad_db_buttons(const struct nk_gamepad_db_mapping* mapping, const unsigned char* buttons, int num_buttons, const float* axes, int num_axes, const unsigned char* hats, int num_hats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#if defined(NK_GAMEPAD_IMPLEMENTATION) && !defined(NK_GAMEPAD_HEADER_ONLY)
+#ifndef NUKLEAR_GAMEPAD_DB_IMPLEMENTATION_ONCE
+#define NUKLEAR_GAMEPAD_DB_IMPLEMENTATION_ONCE
+
+#include <stdlib.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define NK_GAMEPAD_DB_MMAP
+#else
+#include <stdio.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static char nk_gamepad_db_lower(char c) {
+    return (c >= 'A' && c <= 'F') ? (char)(c - 'A' + 'a') : c;
+}
+
+static nk_bool nk_gamepad_db_is_hex(char c) {
+    c = nk_gamepad_db_lower(c);
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f');
+}
+
+/**
+ * FNV-1a hash of a GUID, ignoring case.
+ */
+static unsigned int nk_gamepad_db_hash(const char* guid) {
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < 32; i++) {
+        hash ^= (unsigned char)nk_gamepad_db_lower(guid[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static nk_bool nk_gamepad_db_guid_equals(const char* a, const char* b) {
+    for (int i = 0; i < 32; i++) {
+        if (nk_gamepad_db_lower(a[i]) != nk_gamepad_db_lower(b[i])) {
+            return nk_false;
+        }
+    }
+    return nk_true;
+}
+
+static void nk_gamepad_db_insert(struct nk_gamepad_db* db, unsigned int hash, unsigned int offset) {
+    unsigned int mask = db->capacity - 1;
+    unsigned int i = hash & mask;
+    while (db->entries[i].offset != 0) {
+        i = (i + 1) & mask;
+    }
+    db->entries[i].hash = hash;
+    db->entries[i].offset = offset + 1;
+    db->count++;
+}
+
+/**
+ * Build the GUID index over the database text.
+ */
+static nk_bool nk_gamepad_db_index(struct nk_gamepad_db* db, const char* data, size_t size) {
+    db->data = data;
+    db->size = size;
+    db->count = 0;
+
+    // Size the table from the line count, keeping it at most half full.
+    unsigned int lines = 1;
+    for (size_t i = 0; i < size; i++) {
+        if (data[i] == '\n') {
+            lines++;
+        }
+    }
+    db->capacity = 16;
+    while (db->capacity < lines * 2) {
+        db->capacity <<= 1;
+    }
+    db->entries = (struct nk_gamepad_db_entry*)NK_GAMEPAD_MALLOC(sizeof(struct nk_gamepad_db_entry) * db->capacity);
+    if (db->entries == NULL) {
+        return nk_false;
+    }
+    nk_zero(db->entries, sizeof(struct nk_gamepad_db_entry) * db->capacity);
+
+    // Index every line that starts with a GUID, without parsing the rest of it.
+    size_t line = 0;
+    while (line < size) {
+        size_t end = line;
+        while (end < size && data[end] != '\n') {
+            end++;
+        }
+
+        if (end - line > 33 && data[line + 32] == ',') {
+            nk_bool valid = nk_true;
+            for (int i = 0; i < 32 && valid; i++) {
+                valid = nk_gamepad_db_is_hex(data[line + i]);
+            }
+            if (valid) {
+                nk_gamepad_db_insert(db, nk_gamepad_db_hash(&data[line]), (unsigned int)line);
+            }
+        }
+
+        line = end + 1;
+    }
+
+    return nk_true;
+}
+
+NK_API nk_bool nk_gamepad_db_load_memory(struct nk_gamepad_db* db, const char* data, size_t size) {
+    if (db == NULL || data == NULL) {
+        return nk_false;
+    }
+
+    nk_zero(db, sizeof(struct nk_gamepad_db));
+    if (!nk_gamepad_db_index(db, data, size)) {
+        nk_gamepad_db_free(db);
+        return nk_false;
+    }
+
+    return nk_true;
+}
+
+NK_API nk_bool nk_gamepad_db_load_file(struct nk_gamepad_db* db, const char* path) {
+    if (db == NULL || path == NULL) {
+        return nk_false;
+    }
+    nk_zero(db, sizeof(struct nk_gamepad_db));
+
+#ifdef NK_GAMEPAD_DB_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return nk_false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return nk_false;
+    }
+
+    void* mapped = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        return nk_false;
+    }
+    db->mapped = mapped;
+    db->mapped_size = (size_t)info.st_size;
+#else
+    // No memory mapping available, so read the file in one go.
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        return nk_false;
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (length <= 0) {
+        fclose(file);
+        return nk_false;
+    }
+    db->mapped = NK_GAMEPAD_MALLOC((size_t)length);
+    if (db->mapped == NULL) {
+        fclose(file);
+        return nk_false;
+    }
+    db->mapped_size = fread(db->mapped, 1, (size_t)length, file);
+    fclose(file);
+#endif
+
+    if (!nk_gamepad_db_index(db, (const char*)db->mapped, db->mapped_size)) {
+        nk_gamepad_db_free(db);
+        return nk_false;
+    }
+
+    return nk_true;
+}
+
+NK_API void nk_gamepad_db_free(struct nk_gamepad_db* db) {
+    if (db == NULL) {
+        return;
+    }
+
+    if (db->entries != NULL) {
+        NK_GAMEPAD_FREE(db->entries);
+    }
+
+    if (db->mapped != NULL) {
+#ifdef NK_GAMEPAD_DB_MMAP
+        munmap(db->mapped, db->mapped_size);
+#else
+        NK_GAMEPAD_FREE(db->mapped);
+#endif
+    }
+
+    nk_zero(db, sizeof(struct nk_gamepad_db));
+}
+
+/**
+ * Check whether a field, from start to end, matches the given NULL terminated string.
+ */
+static nk_bool nk_gamepad_db_field_equals(const char* start, const char* end, const char* str) {
+    while (start < end && *str != '\0') {
+        if (*start++ != *str++) {
+            return nk_false;
+        }
+    }
+    return start == end && *str == '\0';
+}
+
+/**
+ * Find the value of a "key:" field on a line, or NULL if the line does not have the field.
+ */
+static const char* nk_gamepad_db_field(const char* line, const char* end, const char* key, const char** value_end) {
+    const char* field = line;
+    while (field < end) {
+        const char* field_end = field;
+        while (field_end < end && *field_end != ',') {
+            field_end++;
+        }
+
+        const char* colon = field;
+        while (colon < field_end && *colon != ':') {
+            colon++;
+        }
+        if (colon < field_end && nk_gamepad_db_field_equals(field, colon, key)) {
+            *value_end = field_end;
+            return colon + 1;
+        }
+
+        field = field_end + 1;
+    }
+
+    return NULL;
+}
+
+static int nk_gamepad_db_parse_int(const char** str, const char* end) {
+    int value = 0;
+    while (*str < end && **str >= '0' && **str <= '9') {
+        value = value * 10 + (**str - '0');
+        (*str)++;
+    }
+    return value;
+}
+
+static struct nk_gamepad_db_binding nk_gamepad_db_parse_binding(const char* value, const char* end) {
+    struct nk_gamepad_db_binding binding;
+    nk_zero(&binding, sizeof(binding));
+
+    if (value < end && (*value == '+' || *value == '-')) {
+        binding.axis_direction = (*value == '+') ? 1 : -1;
+        value++;
+    }
+    if (value >= end) {
+        return binding;
+    }
+
+    switch (*value++) {
+        case 'b':
+            binding.type = NK_GAMEPAD_DB_BINDING_BUTTON;
+            binding.index = nk_gamepad_db_parse_int(&value, end);
+            break;
+        case 'a':
+            binding.type = NK_GAMEPAD_DB_BINDING_AXIS;
+            binding.index = nk_gamepad_db_parse_int(&value, end);
+            binding.axis_inverted = (value < end && *value == '~');
+            break;
+        case 'h':
+            binding.type = NK_GAMEPAD_DB_BINDING_HAT;
+            binding.index = nk_gamepad_db_parse_int(&value, end);
+            if (value < end && *value == '.') {
+                value++;
+                binding.hat_mask = (unsigned int)nk_gamepad_db_parse_int(&value, end);
+            }
+            break;
+    }
+
+    return binding;
+}
+
+/**
+ * The database field name for each button.
+ */
+static const char* const nk_gamepad_db_button_names[NK_GAMEPAD_BUTTON_LAST] = {
+    "dpup", "dpdown", "dpleft", "dpright",
+    "a", "b", "x", "y",
+    "leftshoulder", "rightshoulder",
+    "back", "start", "guide"
+};
+
+static void nk_gamepad_db_parse(const char* line, const char* end, struct nk_gamepad_db_mapping* mapping) {
+    nk_zero(mapping, sizeof(struct nk_gamepad_db_mapping));
+
+    // GUID
+    for (int i = 0; i < 32; i++) {
+        mapping->guid[i] = nk_gamepad_db_lower(line[i]);
+    }
+
+    // Name
+    const char* name = line + 33;
+    int length = 0;
+    while (name < end && *name != ',' && length < NK_GAMEPAD_NAME_SIZE - 1) {
+        mapping->name[length++] = *name++;
+    }
+    while (name < end && *name != ',') {
+        name++;
+    }
+
+    // Buttons
+    for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
+        const char* value_end;
+        const char* value = nk_gamepad_db_field(name + 1, end, nk_gamepad_db_button_names[i], &value_end);
+        if (value != NULL) {
+            mapping->buttons[i] = nk_gamepad_db_parse_binding(value, value_end);
+        }
+    }
+}
+
+NK_API nk_bool nk_gamepad_db_find(struct nk_gamepad_db* db, const char* guid, struct nk_gamepad_db_mapping* mapping) {
+    if (db == NULL || db->entries == NULL || guid == NULL || mapping == NULL) {
+        return nk_false;
+    }
+    for (int i = 0; i < 32; i++) {
+        if (!nk_gamepad_db_is_hex(guid[i])) {
+            return nk_false;
+        }
+    }
+
+    // Entries sharing a GUID sit along the same probe sequence, in file order.
+    const char* found = NULL;
+    const char* found_end = NULL;
+    nk_bool found_platform = nk_false;
+    unsigned int hash = nk_gamepad_db_hash(guid);
+    unsigned int mask = db->capacity - 1;
+    for (unsigned int i = hash & mask; db->entries[i].offset != 0; i = (i + 1) & mask) {
+        if (db->entries[i].hash != hash) {
+            continue;
+        }
+
+        const char* line = db->data + db->entries[i].offset - 1;
+        if (!nk_gamepad_db_guid_equals(line, guid)) {
+            continue;
+        }
+
+        const char* end = line;
+        while (end < db->data + db->size && *end != '\n' && *end != '\r') {
+            end++;
+        }
+
+        // Prefer the entries for this platform, falling back to ones that don't say.
+        const char* platform_end;
+        const char* platform = nk_gamepad_db_field(line, end, "platform", &platform_end);
+        if (platform == NULL) {
+            if (!found_platform) {
+                found = line;
+                found_end = end;
+            }
+        }
+        else if (nk_gamepad_db_field_equals(platform, platform_end, NK_GAMEPAD_DB_PLATFORM)) {
+            found = line;
+            found_end = end;
+            found_platform = nk_true;
+        }
+    }
+
+    if (found == NULL) {
+        return nk_false;
+    }
+
+    nk_gamepad_db_parse(found, found_end, mapping);
+    return nk_true;
+}
+
+NK_API void nk_gamepad_db_guid(char guid[33], unsigned short bus, unsigned short vendor, unsigned short product, unsigned short version) {
+    static const char hex[] = "0123456789abcdef";
+    const unsigned short words[8] = { bus, 0, vendor, 0, product, 0, version, 0 };
+
+    // Each 16-bit word is written little-endian.
+    for (int i = 0; i < 8; i++) {
+        guid[i * 4 + 0] = hex[(words[i] >> 4) & 0x0F];
+        guid[i * 4 + 1] = hex[words[i] & 0x0F];
+        guid[i * 4 + 2] = hex[(words[i] >> 12) & 0x0F];
+        guid[i * 4 + 3] = hex[(words[i] >> 8) & 0x0F];
+    }
+    guid[32] = '\0';
+}
+
+NK_API unsigned int nk_gamepad_db_buttons(const struct nk_gamepad_db_mapping* mapping, const unsigned char* buttons, int num_buttons, const float* axes, int num_axes, const unsigned char* hats, int num_hats) {
+    if (mapping == NULL) {
+        return 0;
+    }
+
+    unsigned int state = 0;
+    for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
+        const struct nk_gamepad_db_binding* binding = &mapping->buttons[i];
+        nk_bool down = nk_false;
+        switch (binding->type) {
+            case NK_GAMEPAD_DB_BINDING_BUTTON:
+                down = buttons != NULL && binding->index < num_buttons && buttons[binding->index] != 0;
+                break;
+            case NK_GAMEPAD_DB_BINDING_AXIS:
+                if (axes != NULL && binding->index < num_axes) {
+                    float value = binding->axis_inverted ? -axes[binding->index] : axes[binding->index];
+                    if (binding->axis_direction < 0) {
+                        down = value < -NK_GAMEPAD_DB_AXIS_THRESHOLD;
+                    }
+                    else if (binding->axis_direction > 0) {
+                        down = value > NK_GAMEPAD_DB_AXIS_THRESHOLD;
+                    }
+                    else {
+                        // A whole axis, such as a trigger, runs from -1 when released to 1 when pressed.
+                        down = value > NK_GAMEPAD_DB_AXIS_THRESHOLD * 2.0f - 1.0f;
+                    }
+                }
+                break;
+            case NK_GAMEPAD_DB_BINDING_HAT:
+                down = hats != NULL && binding->index < num_hats && (hats[binding->index] & binding->hat_mask) != 0;
+                break;
+            default:
+                break;
+        }
+
+        if (down) {
+            state |= NK_GAMEPAD_BUTTON_FLAG(i);
+        }
+    }
+
+    return state;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+#endif
@@ -0,0 +1,250 @@
+#ifndef NUKLEAR_GAMEPAD_DEBUG_H__
+#define NUKLEAR_GAMEPAD_DEBUG_H__
+
+#ifndef NK_GAMEPAD_DEBUG_BUCKETS
+/**
+ * How many power of two buckets the poll cost histogram has, starting from 1 nanosecond.
+ */
+#define NK_GAMEPAD_DEBUG_BUCKETS 24
+#endif  // NK_GAMEPAD_DEBUG_BUCKETS
+
+#ifndef NK_GAMEPAD_DEBUG_BOUNDS
+/**
+ * Where the debug overlay window is first placed.
+ */
+#define NK_GAMEPAD_DEBUG_BOUNDS nk_rect(10, 10, 360, 240)
+#endif  // NK_GAMEPAD_DEBUG_BOUNDS
+
+/**
+ * Poll cost measurements, gathered by wrapping the input source.
+ *
+ * @see nk_gamepad_debug_input_source()
+ */
+struct nk_gamepad_debug {
+    struct nk_gamepad_input_source source; /** The input source being measured. */
+    nk_gamepad_time last; /** How long the latest update took. */
+    nk_gamepad_time max; /** The longest update. */
+    nk_gamepad_time total; /** The time spent in all updates. */
+    unsigned int polls; /** How many updates were measured. */
+    unsigned int histogram[NK_GAMEPAD_DEBUG_BUCKETS]; /** Updates by the power of two of their cost. */
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * An input source that runs another input source, and measures how long each update takes.
+ *
+ * @param debug [nk_gamepad_debug] Where to keep the measurements.
+ * @param source The input source to measure.
+ *
+ * @code
+ * struct nk_gamepad_debug debug;
+ * nk_gamepad_init_with_source(&gamepads, ctx, nk_gamepad_debug_input_source(&debug, nk_gamepad_sdl_input_soure(NULL)));
+ * @endcode
+ */
+NK_API struct nk_gamepad_input_source nk_gamepad_debug_input_source(struct nk_gamepad_debug* debug, struct nk_gamepad_input_source source);
+
+/**
+ * Draw a window with the button masks of each available gamepad and, when the input source is wrapped with
+ * nk_gamepad_debug_input_source(), the poll cost and its histogram. With NK_GAMEPAD_TRACE, the trace counters
+ * of the latest update are shown too.
+ *
+ * Everything is drawn straight to the window canvas from a single widget, so it is cheap to leave enabled.
+ *
+ * @param ctx The Nuklear context.
+ * @param gamepads The gamepad system to inspect.
+ */
+NK_API void nk_gamepad_debug_overlay(struct nk_context* ctx, struct nk_gamepads* gamepads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#if defined(NK_GAMEPAD_IMPLEMENTATION) && !defined(NK_GAMEPAD_HEADER_ONLY)
+#ifndef NUKLEAR_GAMEPAD_DEBUG_IMPLEMENTATION_ONCE
+#define NUKLEAR_GAMEPAD_DEBUG_IMPLEMENTATION_ONCE
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static nk_bool nk_gamepad_debug_init(struct nk_gamepads* gamepads, void* user_data) {
+    struct nk_gamepad_debug* debug = (struct nk_gamepad_debug*)user_data;
+    if (debug->source.init) {
+        return debug->source.init(gamepads, debug->source.user_data);
+    }
+    return nk_true;
+}
+
+static void nk_gamepad_debug_update(struct nk_gamepads* gamepads, void* user_data) {
+    struct nk_gamepad_debug* debug = (struct nk_gamepad_debug*)user_data;
+    nk_gamepad_time start = nk_gamepad_now();
+    if (debug->source.update) {
+        debug->source.update(gamepads, debug->source.user_data);
+    }
+    nk_gamepad_time cost = nk_gamepad_now() - start;
+
+    int bucket = 0;
+    for (nk_gamepad_time rest = cost >> 1; rest != 0 && bucket < NK_GAMEPAD_DEBUG_BUCKETS - 1; rest >>= 1) {
+        bucket++;
+    }
+    debug->histogram[bucket]++;
+    debug->last = cost;
+    debug->total += cost;
+    if (cost > debug->max) {
+        debug->max = cost;
+    }
+    debug->polls++;
+}
+
+static void nk_gamepad_debug_free(struct nk_gamepads* gamepads, void* user_data) {
+    struct nk_gamepad_debug* debug = (struct nk_gamepad_debug*)user_data;
+    if (debug->source.free) {
+        debug->source.free(gamepads, debug->source.user_data);
+    }
+}
+
+static const char* nk_gamepad_debug_name(struct nk_gamepads* gamepads, int num, void* user_data) {
+    struct nk_gamepad_debug* debug = (struct nk_gamepad_debug*)user_data;
+    if (debug->source.name) {
+        return debug->source.name(gamepads, num, debug->source.user_data);
+    }
+    return gamepads->gamepads[num].name;
+}
+
+NK_API struct nk_gamepad_input_source nk_gamepad_debug_input_source(struct nk_gamepad_debug* debug, struct nk_gamepad_input_source source) {
+    nk_zero(debug, sizeof(struct nk_gamepad_debug));
+    debug->source = source;
+
+    struct nk_gamepad_input_source debug_source = {
+        .user_data = debug,
+        .init = &nk_gamepad_debug_init,
+        .update = &nk_gamepad_debug_update,
+        .free = &nk_gamepad_debug_free,
+        .name = &nk_gamepad_debug_name,
+        .persistent = source.persistent,
+    };
+    return debug_source;
+}
+
+/**
+ * Draw a line of text at the cursor, and move the cursor down.
+ */
+static void nk_gamepad_debug_text(struct nk_command_buffer* canvas, const struct nk_user_font* font, struct nk_rect* cursor, const char* text, struct nk_color color) {
+    struct nk_rect line = nk_rect(cursor->x, cursor->y, cursor->w, font->height);
+    nk_draw_text(canvas, line, text, nk_strlen(text), font, nk_rgba(0, 0, 0, 0), color);
+    cursor->y += font->height + 2;
+}
+
+NK_API void nk_gamepad_debug_overlay(struct nk_context* ctx, struct nk_gamepads* gamepads) {
+    if (ctx == NULL || gamepads == NULL) {
+        return;
+    }
+
+    // Find the measurements when the debug input source is in use.
+    struct nk_gamepad_input_source* source = nk_gamepad_input_source(gamepads);
+    struct nk_gamepad_debug* debug = (source->update == &nk_gamepad_debug_update) ? (struct nk_gamepad_debug*)source->user_data : NULL;
+
+    const struct nk_user_font* font = ctx->style.font;
+    const struct nk_color text = nk_rgb(220, 220, 220);
+    const struct nk_color dim = nk_rgb(90, 90, 90);
+    const struct nk_color down = nk_rgb(80, 200, 120);
+    const float line = font->height + 2;
+
+    int available = 0;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        if (gamepads->gamepads[num].available) {
+            available++;
+        }
+    }
+
+    float height = line * (float)(available + 1);
+    if (debug != NULL) {
+        height += line * 4;
+    }
+#ifdef NK_GAMEPAD_TRACE
+    height += line;
+#endif
+
+    if (nk_begin(ctx, "nk_gamepad_debug", NK_GAMEPAD_DEBUG_BOUNDS,
+        NK_WINDOW_BORDER | NK_WINDOW_TITLE | NK_WINDOW_MOVABLE | NK_WINDOW_SCALABLE | NK_WINDOW_MINIMIZABLE))
+    {
+        struct nk_rect bounds;
+        nk_layout_row_dynamic(ctx, height, 1);
+        if (nk_widget(&bounds, ctx) != NK_WIDGET_INVALID) {
+            struct nk_command_buffer* canvas = nk_window_get_canvas(ctx);
+            struct nk_rect cursor = bounds;
+            char buffer[128];
+
+            snprintf(buffer, sizeof(buffer), "%d of %d gamepads available", available, NK_GAMEPAD_MAX);
+            nk_gamepad_debug_text(canvas, font, &cursor, buffer, text);
+
+            // One row per available gamepad: its number, a cell for each button, and the raw mask.
+            const float cell = font->height - 2;
+            for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+                struct nk_gamepad* gamepad = &gamepads->gamepads[num];
+                if (!gamepad->available) {
+                    continue;
+                }
+
+                snprintf(buffer, sizeof(buffer), "%3d", num);
+                nk_draw_text(canvas, nk_rect(cursor.x, cursor.y, line * 2, font->height), buffer, nk_strlen(buffer), font, nk_rgba(0, 0, 0, 0), text);
+                for (int button = 0; button < NK_GAMEPAD_BUTTON_LAST; button++) {
+                    struct nk_rect box = nk_rect(cursor.x + line * 2 + (float)button * (cell + 2), cursor.y + 1, cell, cell);
+                    nk_fill_rect(canvas, box, 0, (gamepad->buttons & NK_GAMEPAD_BUTTON_FLAG(button)) ? down : dim);
+                }
+                snprintf(buffer, sizeof(buffer), "%04x", gamepad->buttons);
+                nk_draw_text(canvas, nk_rect(cursor.x + line * 2 + NK_GAMEPAD_BUTTON_LAST * (cell + 2) + 4, cursor.y, cursor.w, font->height),
+                    buffer, nk_strlen(buffer), font, nk_rgba(0, 0, 0, 0), text);
+                cursor.y += line;
+            }
+
+            if (debug != NULL) {
+                snprintf(buffer, sizeof(buffer), "poll %.1fus  avg %.1fus  max %.1fus",
+                    (double)debug->last / 1000.0,
+                    debug->polls > 0 ? (double)debug->total / (double)debug->polls / 1000.0 : 0.0,
+                    (double)debug->max / 1000.0);
+                nk_gamepad_debug_text(canvas, font, &cursor, buffer, text);
+
+                // The histogram, scaled to its tallest bucket.
+                unsigned int tallest = 1;
+                for (int i = 0; i < NK_GAMEPAD_DEBUG_BUCKETS; i++) {
+                    if (debug->histogram[i] > tallest) {
+                        tallest = debug->histogram[i];
+                    }
+                }
+                const float bar = cursor.w / NK_GAMEPAD_DEBUG_BUCKETS;
+                const float chart = line * 3 - 2;
+                nk_fill_rect(canvas, nk_rect(cursor.x, cursor.y, cursor.w, chart), 0, nk_rgb(30, 30, 30));
+                for (int i = 0; i < NK_GAMEPAD_DEBUG_BUCKETS; i++) {
+                    if (debug->histogram[i] == 0) {
+                        continue;
+                    }
+                    float h = chart * (float)debug->histogram[i] / (float)tallest;
+                    nk_fill_rect(canvas, nk_rect(cursor.x + (float)i * bar, cursor.y + chart - h, bar - 1, h), 0, down);
+                }
+                cursor.y += line * 3;
+            }
+
+#ifdef NK_GAMEPAD_TRACE
+            snprintf(buffer, sizeof(buffer), "calls %u  scanned %u  events %u  frames %llu",
+                gamepads->trace.backend_calls, gamepads->trace.pads_scanned, gamepads->trace.events, gamepads->trace.frames);
+            nk_gamepad_debug_text(canvas, font, &cursor, buffer, text);
+#endif
+        }
+    }
+    nk_end(ctx);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // NUKLEAR_GAMEPAD_DEBUG_IMPLEMENTATION_ONCE
+#endif  // NK_GAMEPAD_IMPLEMENTATION
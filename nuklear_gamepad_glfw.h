@@ -58,20 +58,29 @@ void nk_gamepad_glfw_update(struct nk_gamepads* gamepads, void* user_data) {
 
     GLFWgamepadstate state;
     for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        NK_GAMEPAD_TRACE_COUNT(gamepads, pads_scanned, 1);
         if ((glfwJoystickPresent(num) == GLFW_FALSE) ||
             (glfwJoystickIsGamepad(num) == GLFW_FALSE) ||
             (glfwGetGamepadState(num, &state) == GLFW_FALSE)) {
+            if (gamepads->gamepads[num].available) {
+                NK_GAMEPAD_JOURNAL_WRITE(gamepads, num, "glfw", NK_GAMEPAD_JOURNAL_DISCONNECTED, 0);
+            }
             gamepads->gamepads[num].available = nk_false;
             continue;
         }
 
+        if (!gamepads->gamepads[num].available) {
+            NK_GAMEPAD_JOURNAL_WRITE(gamepads, num, "glfw", NK_GAMEPAD_JOURNAL_CONNECTED, 0);
+        }
         gamepads->gamepads[num].available = nk_true;
+        unsigned int buttons = 0;
         for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
             int glfwButton = nk_gamepad_glfw_map_button(i);
             if (glfwButton >= 0 && state.buttons[glfwButton]) {
-                nk_gamepad_button(gamepads, num, (enum nk_gamepad_button)i, nk_true);
+                buttons |= NK_GAMEPAD_BUTTON_FLAG(i);
             }
         }
+        NK_GAMEPAD_SET_BUTTONS(gamepads, num, buttons);
     }
 }
 
@@ -92,6 +101,7 @@ NK_API struct nk_gamepad_input_source nk_gamepad_glfw_input_soure(void* user_dat
         &nk_gamepad_glfw_update,
         NULL,
         &nk_gamepad_glfw_name,
+        nk_false,
     };
     return source;
 }
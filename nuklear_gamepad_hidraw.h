@@ -0,0 +1,495 @@
+#ifndef NUKLEAR_GAMEPAD_HIDRAW_H__
+#define NUKLEAR_GAMEPAD_HIDRAW_H__
+
+#ifndef NK_GAMEPAD_HIDRAW_MAX_DEVICES
+/**
+ * The amount of /dev/hidraw* nodes to probe when looking for known controllers.
+ */
+#define NK_GAMEPAD_HIDRAW_MAX_DEVICES 16
+#endif  // NK_GAMEPAD_HIDRAW_MAX_DEVICES
+
+#ifndef NK_GAMEPAD_HIDRAW_REPORT_SIZE
+/**
+ * The largest raw HID input report that will be read from a device.
+ */
+#define NK_GAMEPAD_HIDRAW_REPORT_SIZE 128
+#endif  // NK_GAMEPAD_HIDRAW_REPORT_SIZE
+
+/**
+ * Decodes a raw HID input report into a mask of NK_GAMEPAD_BUTTON_FLAG() values.
+ *
+ * The mask is updated in place, so reports that only carry some of the buttons leave the others untouched.
+ *
+ * @param report The raw report, including the report ID as the first byte.
+ * @param size The size of the report in bytes.
+ * @param buttons The button mask to update.
+ *
+ * @return True if the report was decoded, false if it is not an input report this decoder understands.
+ */
+typedef nk_bool (*nk_gamepad_hidraw_decode_fn)(const unsigned char* report, int size, unsigned int* buttons);
+
+/**
+ * A known controller, identified by its USB vendor and product IDs.
+ */
+struct nk_gamepad_hidraw_model {
+    unsigned short vendor;
+    unsigned short product;
+    const char* name;
+    nk_gamepad_hidraw_decode_fn decode;
+};
+
+/**
+ * State of the hidraw input source.
+ *
+ * @see nk_gamepad_hidraw_input_source()
+ */
+struct nk_gamepad_hidraw {
+    int fd[NK_GAMEPAD_MAX]; /** The open hidraw file descriptor for each gamepad, or -1. */
+    int node[NK_GAMEPAD_MAX]; /** The /dev/hidraw* index for each gamepad, or -1. */
+    const struct nk_gamepad_hidraw_model* model[NK_GAMEPAD_MAX];
+    unsigned int buttons[NK_GAMEPAD_MAX]; /** Last decoded state, as reports only arrive on change. */
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Raw HID input source for Linux, reading /dev/hidraw* directly for a table of known controllers.
+ *
+ * The user needs read access to the hidraw nodes, usually through a udev rule.
+ *
+ * @param user_data [nk_gamepad_hidraw] The state to use. If NULL, an internal state is used.
+ *
+ * @return The input source for hidraw devices.
+ */
+NK_API struct nk_gamepad_input_source nk_gamepad_hidraw_input_source(void* user_data);
+NK_API nk_bool nk_gamepad_hidraw_init(struct nk_gamepads* gamepads, void* user_data);
+NK_API void nk_gamepad_hidraw_update(struct nk_gamepads* gamepads, void* user_data);
+NK_API void nk_gamepad_hidraw_free(struct nk_gamepads* gamepads, void* user_data);
+NK_API const char* nk_gamepad_hidraw_name(struct nk_gamepads* gamepads, int num, void* user_data);
+
+/**
+ * Probe the hidraw nodes again, and open any newly connected known controllers into free gamepad slots.
+ *
+ * @return The amount of controllers that were opened.
+ */
+NK_API int nk_gamepad_hidraw_scan(struct nk_gamepads* gamepads, void* user_data);
+
+/**
+ * Find the known controller model for the given USB vendor and product IDs.
+ *
+ * @return The model, or NULL if the controller is not known.
+ */
+NK_API const struct nk_gamepad_hidraw_model* nk_gamepad_hidraw_find_model(unsigned short vendor, unsigned short product);
+
+NK_API nk_bool nk_gamepad_hidraw_decode_xbox(const unsigned char* report, int size, unsigned int* buttons);
+NK_API nk_bool nk_gamepad_hidraw_decode_ds4(const unsigned char* report, int size, unsigned int* buttons);
+NK_API nk_bool nk_gamepad_hidraw_decode_dualsense(const unsigned char* report, int size, unsigned int* buttons);
+NK_API nk_bool nk_gamepad_hidraw_decode_switch_pro(const unsigned char* report, int size, unsigned int* buttons);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#if defined(NK_GAMEPAD_IMPLEMENTATION) && !defined(NK_GAMEPAD_HEADER_ONLY)
+#ifndef NUKLEAR_GAMEPAD_HIDRAW_IMPLEMENTATION_ONCE
+#define NUKLEAR_GAMEPAD_HIDRAW_IMPLEMENTATION_ONCE
+
+#ifndef NK_GAMEPAD_DEFAULT_INPUT_SOURCE
+#define NK_GAMEPAD_DEFAULT_INPUT_SOURCE nk_gamepad_hidraw_input_source
+#endif
+
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/hidraw.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * D-pad state for each value of a HID hat switch, clockwise starting from up. Anything past 7 is centered.
+ */
+static const unsigned int nk_gamepad_hidraw_hat[9] = {
+    NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_UP),
+    NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_UP) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_RIGHT),
+    NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_RIGHT),
+    NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_DOWN) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_RIGHT),
+    NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_DOWN),
+    NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_DOWN) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LEFT),
+    NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LEFT),
+    NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_UP) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LEFT),
+    0
+};
+
+static unsigned int nk_gamepad_hidraw_map_hat(unsigned int hat) {
+    return nk_gamepad_hidraw_hat[hat > 8 ? 8 : hat];
+}
+
+static unsigned int nk_gamepad_hidraw_map_bit(unsigned char value, unsigned char bit, enum nk_gamepad_button button) {
+    return (value & bit) ? (unsigned int)NK_GAMEPAD_BUTTON_FLAG(button) : 0;
+}
+
+/**
+ * Xbox Wireless controllers over Bluetooth (Xbox One S and Series X|S firmware 5.x layout).
+ */
+NK_API nk_bool nk_gamepad_hidraw_decode_xbox(const unsigned char* report, int size, unsigned int* buttons) {
+    if (report == NULL || buttons == NULL || size < 2) {
+        return nk_false;
+    }
+
+    // Older firmware reports the Xbox button on its own.
+    if (report[0] == 0x02) {
+        *buttons = (*buttons & ~(unsigned int)NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_GUIDE)) |
+            nk_gamepad_hidraw_map_bit(report[1], 0x01, NK_GAMEPAD_BUTTON_GUIDE);
+        return nk_true;
+    }
+
+    if (report[0] != 0x01 || size < 16) {
+        return nk_false;
+    }
+
+    // Sticks and triggers take the first 12 bytes, followed by a 1-based hat switch.
+    unsigned int state = (report[13] == 0) ? 0 : nk_gamepad_hidraw_map_hat(report[13] - 1u);
+    state |= nk_gamepad_hidraw_map_bit(report[14], 0x01, NK_GAMEPAD_BUTTON_A);
+    state |= nk_gamepad_hidraw_map_bit(report[14], 0x02, NK_GAMEPAD_BUTTON_B);
+    state |= nk_gamepad_hidraw_map_bit(report[14], 0x08, NK_GAMEPAD_BUTTON_X);
+    state |= nk_gamepad_hidraw_map_bit(report[14], 0x10, NK_GAMEPAD_BUTTON_Y);
+    state |= nk_gamepad_hidraw_map_bit(report[14], 0x40, NK_GAMEPAD_BUTTON_LB);
+    state |= nk_gamepad_hidraw_map_bit(report[14], 0x80, NK_GAMEPAD_BUTTON_RB);
+    state |= nk_gamepad_hidraw_map_bit(report[15], 0x04, NK_GAMEPAD_BUTTON_BACK);
+    state |= nk_gamepad_hidraw_map_bit(report[15], 0x08, NK_GAMEPAD_BUTTON_START);
+    state |= nk_gamepad_hidraw_map_bit(report[15], 0x10, NK_GAMEPAD_BUTTON_GUIDE);
+
+    *buttons = state;
+    return nk_true;
+}
+
+/**
+ * Decode the DualShock 4 button block, which starts with the hat switch and face buttons.
+ */
+static unsigned int nk_gamepad_hidraw_ds4_buttons(const unsigned char* block) {
+    unsigned int state = nk_gamepad_hidraw_map_hat(block[0] & 0x0F);
+    state |= nk_gamepad_hidraw_map_bit(block[0], 0x10, NK_GAMEPAD_BUTTON_X); // Square
+    state |= nk_gamepad_hidraw_map_bit(block[0], 0x20, NK_GAMEPAD_BUTTON_A); // Cross
+    state |= nk_gamepad_hidraw_map_bit(block[0], 0x40, NK_GAMEPAD_BUTTON_B); // Circle
+    state |= nk_gamepad_hidraw_map_bit(block[0], 0x80, NK_GAMEPAD_BUTTON_Y); // Triangle
+    state |= nk_gamepad_hidraw_map_bit(block[1], 0x01, NK_GAMEPAD_BUTTON_LB);
+    state |= nk_gamepad_hidraw_map_bit(block[1], 0x02, NK_GAMEPAD_BUTTON_RB);
+    state |= nk_gamepad_hidraw_map_bit(block[1], 0x10, NK_GAMEPAD_BUTTON_BACK); // Share / Create
+    state |= nk_gamepad_hidraw_map_bit(block[1], 0x20, NK_GAMEPAD_BUTTON_START); // Options
+    state |= nk_gamepad_hidraw_map_bit(block[2], 0x01, NK_GAMEPAD_BUTTON_GUIDE); // PS
+    return state;
+}
+
+/**
+ * DualShock 4, over USB (report 0x01) or Bluetooth (report 0x11).
+ */
+NK_API nk_bool nk_gamepad_hidraw_decode_ds4(const unsigned char* report, int size, unsigned int* buttons) {
+    if (report == NULL || buttons == NULL || size < 1) {
+        return nk_false;
+    }
+
+    // The four stick axes come before the buttons. Bluetooth reports have two extra bytes up front.
+    if (report[0] == 0x01 && size >= 8) {
+        *buttons = nk_gamepad_hidraw_ds4_buttons(&report[5]);
+        return nk_true;
+    }
+    if (report[0] == 0x11 && size >= 10) {
+        *buttons = nk_gamepad_hidraw_ds4_buttons(&report[7]);
+        return nk_true;
+    }
+
+    return nk_false;
+}
+
+/**
+ * DualSense, over USB (report 0x01) or Bluetooth (report 0x31).
+ */
+NK_API nk_bool nk_gamepad_hidraw_decode_dualsense(const unsigned char* report, int size, unsigned int* buttons) {
+    if (report == NULL || buttons == NULL || size < 1) {
+        return nk_false;
+    }
+
+    // Before the full report mode is enabled over Bluetooth, a short DualShock 4 style report is sent.
+    if (report[0] == 0x01 && size < 11) {
+        return nk_gamepad_hidraw_decode_ds4(report, size, buttons);
+    }
+
+    // Sticks, triggers and a sequence number come before the buttons.
+    if (report[0] == 0x01) {
+        *buttons = nk_gamepad_hidraw_ds4_buttons(&report[8]);
+        return nk_true;
+    }
+    if (report[0] == 0x31 && size >= 12) {
+        *buttons = nk_gamepad_hidraw_ds4_buttons(&report[9]);
+        return nk_true;
+    }
+
+    return nk_false;
+}
+
+/**
+ * Nintendo Switch Pro Controller. Buttons are mapped by position, so Nintendo's B is NK_GAMEPAD_BUTTON_A.
+ *
+ * Over USB the controller only sends full reports (0x30) once the hid-nintendo driver has done its handshake.
+ */
+NK_API nk_bool nk_gamepad_hidraw_decode_switch_pro(const unsigned char* report, int size, unsigned int* buttons) {
+    if (report == NULL || buttons == NULL || size < 1) {
+        return nk_false;
+    }
+
+    // Full input report, also echoed at the start of subcommand replies.
+    if ((report[0] == 0x30 || report[0] == 0x21) && size >= 6) {
+        unsigned int state = 0;
+        state |= nk_gamepad_hidraw_map_bit(report[3], 0x01, NK_GAMEPAD_BUTTON_X); // Y
+        state |= nk_gamepad_hidraw_map_bit(report[3], 0x02, NK_GAMEPAD_BUTTON_Y); // X
+        state |= nk_gamepad_hidraw_map_bit(report[3], 0x04, NK_GAMEPAD_BUTTON_A); // B
+        state |= nk_gamepad_hidraw_map_bit(report[3], 0x08, NK_GAMEPAD_BUTTON_B); // A
+        state |= nk_gamepad_hidraw_map_bit(report[3], 0x40, NK_GAMEPAD_BUTTON_RB);
+        state |= nk_gamepad_hidraw_map_bit(report[4], 0x01, NK_GAMEPAD_BUTTON_BACK); // Minus
+        state |= nk_gamepad_hidraw_map_bit(report[4], 0x02, NK_GAMEPAD_BUTTON_START); // Plus
+        state |= nk_gamepad_hidraw_map_bit(report[4], 0x10, NK_GAMEPAD_BUTTON_GUIDE); // Home
+        state |= nk_gamepad_hidraw_map_bit(report[5], 0x01, NK_GAMEPAD_BUTTON_DOWN);
+        state |= nk_gamepad_hidraw_map_bit(report[5], 0x02, NK_GAMEPAD_BUTTON_UP);
+        state |= nk_gamepad_hidraw_map_bit(report[5], 0x04, NK_GAMEPAD_BUTTON_RIGHT);
+        state |= nk_gamepad_hidraw_map_bit(report[5], 0x08, NK_GAMEPAD_BUTTON_LEFT);
+        state |= nk_gamepad_hidraw_map_bit(report[5], 0x40, NK_GAMEPAD_BUTTON_LB);
+        *buttons = state;
+        return nk_true;
+    }
+
+    // Simple HID report, sent over Bluetooth by default.
+    if (report[0] == 0x3F && size >= 4) {
+        unsigned int state = nk_gamepad_hidraw_map_hat(report[3]);
+        state |= nk_gamepad_hidraw_map_bit(report[1], 0x01, NK_GAMEPAD_BUTTON_A); // B
+        state |= nk_gamepad_hidraw_map_bit(report[1], 0x02, NK_GAMEPAD_BUTTON_B); // A
+        state |= nk_gamepad_hidraw_map_bit(report[1], 0x04, NK_GAMEPAD_BUTTON_X); // Y
+        state |= nk_gamepad_hidraw_map_bit(report[1], 0x08, NK_GAMEPAD_BUTTON_Y); // X
+        state |= nk_gamepad_hidraw_map_bit(report[1], 0x10, NK_GAMEPAD_BUTTON_LB);
+        state |= nk_gamepad_hidraw_map_bit(report[1], 0x20, NK_GAMEPAD_BUTTON_RB);
+        state |= nk_gamepad_hidraw_map_bit(report[2], 0x01, NK_GAMEPAD_BUTTON_BACK); // Minus
+        state |= nk_gamepad_hidraw_map_bit(report[2], 0x02, NK_GAMEPAD_BUTTON_START); // Plus
+        state |= nk_gamepad_hidraw_map_bit(report[2], 0x10, NK_GAMEPAD_BUTTON_GUIDE); // Home
+        *buttons = state;
+        return nk_true;
+    }
+
+    return nk_false;
+}
+
+/**
+ * Known controllers.
+ */
+static const struct nk_gamepad_hidraw_model nk_gamepad_hidraw_models[] = {
+    { 0x045E, 0x02FD, "Xbox One S Controller", &nk_gamepad_hidraw_decode_xbox },
+    { 0x045E, 0x0B13, "Xbox Series X Controller", &nk_gamepad_hidraw_decode_xbox },
+    { 0x054C, 0x05C4, "PS4 Controller", &nk_gamepad_hidraw_decode_ds4 },
+    { 0x054C, 0x09CC, "PS4 Controller", &nk_gamepad_hidraw_decode_ds4 },
+    { 0x054C, 0x0CE6, "PS5 Controller", &nk_gamepad_hidraw_decode_dualsense },
+    { 0x054C, 0x0DF2, "PS5 Controller", &nk_gamepad_hidraw_decode_dualsense },
+    { 0x057E, 0x2009, "Switch Pro Controller", &nk_gamepad_hidraw_decode_switch_pro },
+};
+
+NK_API const struct nk_gamepad_hidraw_model* nk_gamepad_hidraw_find_model(unsigned short vendor, unsigned short product) {
+    for (int i = 0; i < (int)(sizeof(nk_gamepad_hidraw_models) / sizeof(nk_gamepad_hidraw_models[0])); i++) {
+        if (nk_gamepad_hidraw_models[i].vendor == vendor && nk_gamepad_hidraw_models[i].product == product) {
+            return &nk_gamepad_hidraw_models[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Internal state used when no nk_gamepad_hidraw is provided as the user data.
+ */
+static struct nk_gamepad_hidraw nk_gamepad_hidraw_default;
+
+static struct nk_gamepad_hidraw* nk_gamepad_hidraw_state(void* user_data) {
+    return (user_data == NULL) ? &nk_gamepad_hidraw_default : (struct nk_gamepad_hidraw*)user_data;
+}
+
+static void nk_gamepad_hidraw_close(struct nk_gamepads* gamepads, struct nk_gamepad_hidraw* hidraw, int num) {
+#ifdef __linux__
+    if (hidraw->fd[num] >= 0) {
+        close(hidraw->fd[num]);
+    }
+#endif
+    hidraw->fd[num] = -1;
+    hidraw->node[num] = -1;
+    hidraw->model[num] = NULL;
+    hidraw->buttons[num] = 0;
+    gamepads->gamepads[num].available = nk_false;
+}
+
+NK_API int nk_gamepad_hidraw_scan(struct nk_gamepads* gamepads, void* user_data) {
+    if (gamepads == NULL) {
+        return 0;
+    }
+
+    int opened = 0;
+#ifdef __linux__
+    struct nk_gamepad_hidraw* hidraw = nk_gamepad_hidraw_state(user_data);
+    for (int node = 0; node < NK_GAMEPAD_HIDRAW_MAX_DEVICES; node++) {
+        // Skip nodes that are already open, and find a free slot.
+        int slot = -1;
+        nk_bool in_use = nk_false;
+        for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+            if (hidraw->node[num] == node) {
+                in_use = nk_true;
+                break;
+            }
+            if (slot < 0 && hidraw->fd[num] < 0) {
+                slot = num;
+            }
+        }
+        if (in_use) {
+            continue;
+        }
+        if (slot < 0) {
+            break;
+        }
+
+        char path[32];
+        snprintf(path, sizeof(path), "/dev/hidraw%d", node);
+        int fd = open(path, O_RDONLY | O_NONBLOCK);
+        if (fd < 0) {
+            // Missing nodes are expected, but anything else, like not having permission, is worth knowing about. The node
+            // isn't any gamepad yet, so it isn't journaled against one.
+            if (errno != ENOENT) {
+                NK_GAMEPAD_JOURNAL_WRITE(gamepads, -1, "hidraw", NK_GAMEPAD_JOURNAL_OPEN_FAILED, errno);
+            }
+            continue;
+        }
+
+        struct hidraw_devinfo info;
+        const struct nk_gamepad_hidraw_model* model = NULL;
+        if (ioctl(fd, HIDIOCGRAWINFO, &info) >= 0) {
+            model = nk_gamepad_hidraw_find_model((unsigned short)info.vendor, (unsigned short)info.product);
+        }
+        if (model == NULL) {
+            close(fd);
+            continue;
+        }
+
+        hidraw->fd[slot] = fd;
+        hidraw->node[slot] = node;
+        hidraw->model[slot] = model;
+        hidraw->buttons[slot] = 0;
+        gamepads->gamepads[slot].available = nk_true;
+        NK_GAMEPAD_JOURNAL_WRITE(gamepads, slot, "hidraw", NK_GAMEPAD_JOURNAL_CONNECTED, node);
+        opened++;
+    }
+#else
+    NK_UNUSED(user_data);
+#endif
+
+    return opened;
+}
+
+NK_API nk_bool nk_gamepad_hidraw_init(struct nk_gamepads* gamepads, void* user_data) {
+    if (gamepads == NULL) {
+        return nk_false;
+    }
+
+    struct nk_gamepad_hidraw* hidraw = nk_gamepad_hidraw_state(user_data);
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        hidraw->fd[num] = -1;
+        hidraw->node[num] = -1;
+        hidraw->model[num] = NULL;
+        hidraw->buttons[num] = 0;
+        gamepads->gamepads[num].available = nk_false;
+    }
+
+    nk_gamepad_hidraw_scan(gamepads, user_data);
+    return nk_true;
+}
+
+NK_API void nk_gamepad_hidraw_update(struct nk_gamepads* gamepads, void* user_data) {
+    if (gamepads == NULL) {
+        return;
+    }
+
+    struct nk_gamepad_hidraw* hidraw = nk_gamepad_hidraw_state(user_data);
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        if (hidraw->fd[num] < 0) {
+            continue;
+        }
+        NK_GAMEPAD_TRACE_COUNT(gamepads, pads_scanned, 1);
+
+#ifdef __linux__
+        // Drain every pending report, so the state is as fresh as possible.
+        unsigned char report[NK_GAMEPAD_HIDRAW_REPORT_SIZE];
+        for (;;) {
+            ssize_t size = read(hidraw->fd[num], report, sizeof(report));
+            if (size > 0) {
+                NK_GAMEPAD_TRACE_COUNT(gamepads, events, 1);
+                hidraw->model[num]->decode(report, (int)size, &hidraw->buttons[num]);
+                continue;
+            }
+            if (size < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+                break;
+            }
+
+            // The device was unplugged.
+            nk_gamepad_hidraw_close(gamepads, hidraw, num);
+            NK_GAMEPAD_JOURNAL_WRITE(gamepads, num, "hidraw", NK_GAMEPAD_JOURNAL_DISCONNECTED, 0);
+            break;
+        }
+        if (hidraw->fd[num] < 0) {
+            continue;
+        }
+#endif
+
+        nk_gamepad_set_buttons(gamepads, num, hidraw->buttons[num]);
+    }
+}
+
+NK_API void nk_gamepad_hidraw_free(struct nk_gamepads* gamepads, void* user_data) {
+    if (gamepads == NULL) {
+        return;
+    }
+
+    struct nk_gamepad_hidraw* hidraw = nk_gamepad_hidraw_state(user_data);
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        if (hidraw->fd[num] >= 0) {
+            nk_gamepad_hidraw_close(gamepads, hidraw, num);
+        }
+    }
+}
+
+NK_API const char* nk_gamepad_hidraw_name(struct nk_gamepads* gamepads, int num, void* user_data) {
+    struct nk_gamepad_hidraw* hidraw = nk_gamepad_hidraw_state(user_data);
+    if (hidraw->model[num] == NULL) {
+        return gamepads->gamepads[num].name;
+    }
+
+    return hidraw->model[num]->name;
+}
+
+NK_API struct nk_gamepad_input_source nk_gamepad_hidraw_input_source(void* user_data) {
+    struct nk_gamepad_input_source source = {
+        .user_data = user_data,
+        .init = &nk_gamepad_hidraw_init,
+        .update = &nk_gamepad_hidraw_update,
+        .free = &nk_gamepad_hidraw_free,
+        .name = &nk_gamepad_hidraw_name,
+    };
+    return source;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+#endif
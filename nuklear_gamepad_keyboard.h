@@ -24,6 +24,7 @@ extern "C" {
  * Keyboard input source for the gamepad.
  *
  * Since Nuklear's text buffer is cleared every frame, this only captures button presses, not holds.
+ * With NK_GAMEPAD_ACTIVE, its presses are reported by nk_gamepad_last_active() as NK_GAMEPAD_ACTIVE_KEYBOARD.
  *
  * @param user_data [nk_gamepad_keyboard_map] A custom keyboard map. If NULL, the default keyboard map is used.
  *
@@ -68,10 +69,11 @@ NK_API void nk_gamepad_keyboard_update(struct nk_gamepads* gamepads, void* user_
     struct nk_gamepad_keyboard_map* map = (user_data == NULL) ? &nk_gamepad_keyboard_map_default : (struct nk_gamepad_keyboard_map*)user_data;
 
     // Keys
+    unsigned int buttons = 0;
     for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
         enum nk_keys key = map->keys[i];
-        if (key != NK_KEY_NONE) {
-            nk_gamepad_button(gamepads, 0, (enum nk_gamepad_button)i, nk_input_is_key_down(&gamepads->ctx->input, key));
+        if (key != NK_KEY_NONE && nk_input_is_key_down(&gamepads->ctx->input, key)) {
+            buttons |= NK_GAMEPAD_BUTTON_FLAG(i);
         }
     }
 
@@ -84,9 +86,11 @@ NK_API void nk_gamepad_keyboard_update(struct nk_gamepads* gamepads, void* user_
 
         int character = gamepads->ctx->input.keyboard.text[i];
         if (map->chars[character] != NK_GAMEPAD_BUTTON_INVALID) {
-            nk_gamepad_button(gamepads, 0, map->chars[character], nk_true);
+            buttons |= NK_GAMEPAD_BUTTON_FLAG(map->chars[character]);
         }
     }
+
+    nk_gamepad_set_buttons(gamepads, 0, buttons);
 }
 
 NK_API nk_bool nk_gamepad_keyboard_init(struct nk_gamepads* gamepads, void* user_data) {
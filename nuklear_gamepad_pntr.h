@@ -51,17 +51,22 @@ int nk_gamepad_pntr_map_button(int button) {
 }
 
 void nk_gamepad_pntr_update(struct nk_gamepads* gamepads, void* user_data) {
+    NK_UNUSED(user_data);
     if (!gamepads || !gamepads->input_source.user_data) {
         return;
     }
 
-    for (int num = 0; num < PNTR_APP_MAX_GAMEPADS; num++) {
+    // pntr_app may track more gamepads than there is room for.
+    for (int num = 0; num < PNTR_APP_MAX_GAMEPADS && num < NK_GAMEPAD_MAX; num++) {
+        NK_GAMEPAD_TRACE_COUNT(gamepads, pads_scanned, 1);
         gamepads->gamepads[num].available = nk_true;
+        unsigned int buttons = 0;
         for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
             if (pntr_app_gamepad_button_down(gamepads->input_source.user_data, num, nk_gamepad_pntr_map_button(i))) {
-                nk_gamepad_button(gamepads, num, (enum nk_gamepad_button)i, nk_true);
+                buttons |= NK_GAMEPAD_BUTTON_FLAG(i);
             }
         }
+        NK_GAMEPAD_SET_BUTTONS(gamepads, num, buttons);
     }
 }
 
@@ -72,6 +77,7 @@ NK_API struct nk_gamepad_input_source nk_gamepad_pntr_input_soure(void* user_dat
         &nk_gamepad_pntr_update,
         NULL,
         NULL,
+        nk_false,
     };
     return source;
 }
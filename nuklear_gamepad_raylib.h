@@ -53,17 +53,26 @@ void nk_gamepad_raylib_update(struct nk_gamepads* gamepads, void* user_data) {
     }
 
     for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        NK_GAMEPAD_TRACE_COUNT(gamepads, pads_scanned, 1);
         if (!IsGamepadAvailable(num)) {
+            if (gamepads->gamepads[num].available) {
+                NK_GAMEPAD_JOURNAL_WRITE(gamepads, num, "raylib", NK_GAMEPAD_JOURNAL_DISCONNECTED, 0);
+            }
             gamepads->gamepads[num].available = nk_false;
             continue;
         }
 
+        if (!gamepads->gamepads[num].available) {
+            NK_GAMEPAD_JOURNAL_WRITE(gamepads, num, "raylib", NK_GAMEPAD_JOURNAL_CONNECTED, 0);
+        }
         gamepads->gamepads[num].available = nk_true;
+        unsigned int buttons = 0;
         for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
             if (IsGamepadButtonDown(num, nk_gamepad_raylib_map_button(i))) {
-                nk_gamepad_button(gamepads, num, (enum nk_gamepad_button)i, nk_true);
+                buttons |= NK_GAMEPAD_BUTTON_FLAG(i);
             }
         }
+        NK_GAMEPAD_SET_BUTTONS(gamepads, num, buttons);
     }
 }
 
@@ -84,6 +93,7 @@ NK_API struct nk_gamepad_input_source nk_gamepad_raylib_input_soure(void* user_d
         &nk_gamepad_raylib_update,
         NULL,
         &nk_gamepad_raylib_name,
+        nk_false,
     };
     return source;
 }
@@ -0,0 +1,621 @@
+#ifndef NUKLEAR_GAMEPAD_RECORD_H__
+#define NUKLEAR_GAMEPAD_RECORD_H__
+
+#include <stddef.h>
+#include <stdio.h>
+
+#if !defined(NK_GAMEPAD_RECORD_NO_THREADS) && (defined(__unix__) || defined(__APPLE__))
+/**
+ * Write traces from a background thread. Define NK_GAMEPAD_RECORD_NO_THREADS to write from the update instead.
+ */
+#define NK_GAMEPAD_RECORD_THREADS
+#include <pthread.h>
+#endif
+
+#ifndef NK_GAMEPAD_RECORD_CHUNK_SIZE
+/**
+ * The size of each buffer that is handed to the trace writer.
+ */
+#define NK_GAMEPAD_RECORD_CHUNK_SIZE 8192
+#endif  // NK_GAMEPAD_RECORD_CHUNK_SIZE
+
+#ifndef NK_GAMEPAD_RECORD_CHUNKS
+/**
+ * How many buffers can be queued for the trace writer before recording has to wait for it.
+ */
+#define NK_GAMEPAD_RECORD_CHUNKS 4
+#endif  // NK_GAMEPAD_RECORD_CHUNKS
+
+/**
+ * The most a single frame can take: a varint each for the skipped frames and the change count, and two per gamepad.
+ *
+ * @internal
+ */
+#define NK_GAMEPAD_RECORD_FRAME_SIZE (10 + NK_GAMEPAD_MAX * 10)
+
+#if NK_GAMEPAD_RECORD_CHUNK_SIZE < NK_GAMEPAD_RECORD_FRAME_SIZE
+#error "NK_GAMEPAD_RECORD_CHUNK_SIZE is too small to hold a frame of NK_GAMEPAD_MAX gamepads"
+#endif
+
+/**
+ * Bit of a recorded gamepad state that holds whether the gamepad is available.
+ */
+#define NK_GAMEPAD_RECORD_AVAILABLE 0x80000000u
+
+/**
+ * Records the state of every gamepad, frame by frame, while passing through another input source.
+ *
+ * Traces start with "NKGP", a version byte and the gamepad count as a varint. Each frame with changes is then
+ * written as varints: the amount of unchanged frames before it, the amount of changed gamepads, and for each one
+ * the gamepad index delta and its state XOR the previous state. A frame with no changed gamepads ends the trace.
+ *
+ * @see nk_gamepad_recorder_open()
+ */
+struct nk_gamepad_recorder {
+    struct nk_gamepad_input_source source; /** The input source being recorded. */
+    FILE* file;
+    unsigned int state[NK_GAMEPAD_MAX];
+    unsigned int skip; /** Frames without changes since the last written frame. */
+    unsigned int frames;
+    unsigned int stalls; /** How many times recording had to wait for the writer. */
+    unsigned char chunks[NK_GAMEPAD_RECORD_CHUNKS][NK_GAMEPAD_RECORD_CHUNK_SIZE];
+    int chunk_size[NK_GAMEPAD_RECORD_CHUNKS];
+    int fill; /** The chunk being filled by recording. */
+    int flush; /** The next chunk for the writer. */
+    int pending; /** Chunks waiting for the writer. */
+    nk_bool stop;
+#ifdef NK_GAMEPAD_RECORD_THREADS
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+#endif
+};
+
+/**
+ * Plays a recorded trace back as an input source.
+ *
+ * @see nk_gamepad_replay_open_file()
+ */
+struct nk_gamepad_replay {
+    const unsigned char* data;
+    size_t size;
+    size_t pos;
+    size_t start; /** Where the first frame starts, after the header. */
+    int count; /** The amount of gamepads in the trace. */
+    unsigned int state[NK_GAMEPAD_MAX];
+    unsigned int skip;
+    unsigned int changes;
+    nk_bool has_frame; /** Whether skip and changes have been read for the next frame. */
+    nk_bool finished;
+    nk_bool loop; /** Start over once the end of the trace is reached. */
+    unsigned int frame;
+    void* mapped;
+    size_t mapped_size;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Start recording another input source to a file.
+ *
+ * @param recorder The recorder.
+ * @param path Where to write the trace.
+ * @param source The input source to pass through and record.
+ *
+ * @return True if the trace file was opened, false otherwise.
+ *
+ * @see nk_gamepad_recorder_input_source()
+ */
+NK_API nk_bool nk_gamepad_recorder_open(struct nk_gamepad_recorder* recorder, const char* path, struct nk_gamepad_input_source source);
+
+/**
+ * Finish the trace, waiting for the writer. This is also done when the gamepads are freed.
+ */
+NK_API void nk_gamepad_recorder_close(struct nk_gamepad_recorder* recorder);
+
+/**
+ * An input source that runs the recorded input source, and records the gamepad states after each update.
+ *
+ * @param recorder [nk_gamepad_recorder] An open recorder.
+ */
+NK_API struct nk_gamepad_input_source nk_gamepad_recorder_input_source(struct nk_gamepad_recorder* recorder);
+
+/**
+ * Load a trace that is already in memory. The data is not copied, and must outlive the replay.
+ *
+ * @return True if the trace header is valid, false otherwise.
+ */
+NK_API nk_bool nk_gamepad_replay_open_memory(struct nk_gamepad_replay* replay, const void* data, size_t size);
+
+/**
+ * Map a trace file into memory for playback.
+ *
+ * @return True if the trace was loaded, false otherwise.
+ */
+NK_API nk_bool nk_gamepad_replay_open_file(struct nk_gamepad_replay* replay, const char* path);
+
+/**
+ * Unmap the trace, if it was loaded from a file.
+ */
+NK_API void nk_gamepad_replay_close(struct nk_gamepad_replay* replay);
+
+/**
+ * An input source that plays back one frame of the trace each update.
+ *
+ * @param replay [nk_gamepad_replay] An open replay.
+ */
+NK_API struct nk_gamepad_input_source nk_gamepad_replay_input_source(struct nk_gamepad_replay* replay);
+
+/**
+ * Check whether the replay has played all the frames of the trace.
+ */
+NK_API nk_bool nk_gamepad_replay_finished(struct nk_gamepad_replay* replay);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#if defined(NK_GAMEPAD_IMPLEMENTATION) && !defined(NK_GAMEPAD_HEADER_ONLY)
+#ifndef NUKLEAR_GAMEPAD_RECORD_IMPLEMENTATION_ONCE
+#define NUKLEAR_GAMEPAD_RECORD_IMPLEMENTATION_ONCE
+
+#include <stdlib.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define NK_GAMEPAD_RECORD_MMAP
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static int nk_gamepad_record_write_varint(unsigned char* out, unsigned int value) {
+    int size = 0;
+    while (value >= 0x80) {
+        out[size++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    out[size++] = (unsigned char)value;
+    return size;
+}
+
+static nk_bool nk_gamepad_record_read_varint(const unsigned char* data, size_t size, size_t* pos, unsigned int* value) {
+    unsigned int result = 0;
+    for (int shift = 0; shift < 35 && *pos < size; shift += 7) {
+        unsigned char byte = data[(*pos)++];
+        result |= (unsigned int)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            return nk_true;
+        }
+    }
+    return nk_false;
+}
+
+#ifdef NK_GAMEPAD_RECORD_THREADS
+static void* nk_gamepad_recorder_thread(void* data) {
+    struct nk_gamepad_recorder* recorder = (struct nk_gamepad_recorder*)data;
+    pthread_mutex_lock(&recorder->mutex);
+    for (;;) {
+        while (recorder->pending == 0 && !recorder->stop) {
+            pthread_cond_wait(&recorder->cond, &recorder->mutex);
+        }
+        if (recorder->pending == 0) {
+            break;
+        }
+
+        // Write outside of the lock, so recording can keep filling the other chunks.
+        int chunk = recorder->flush;
+        pthread_mutex_unlock(&recorder->mutex);
+        fwrite(recorder->chunks[chunk], 1, (size_t)recorder->chunk_size[chunk], recorder->file);
+        pthread_mutex_lock(&recorder->mutex);
+
+        recorder->flush = (recorder->flush + 1) % NK_GAMEPAD_RECORD_CHUNKS;
+        recorder->pending--;
+        pthread_cond_broadcast(&recorder->cond);
+    }
+    pthread_mutex_unlock(&recorder->mutex);
+    return NULL;
+}
+#endif
+
+/**
+ * Hand the chunk being filled to the writer, and move on to the next one.
+ */
+static void nk_gamepad_recorder_submit(struct nk_gamepad_recorder* recorder) {
+    if (recorder->chunk_size[recorder->fill] == 0) {
+        return;
+    }
+
+#ifdef NK_GAMEPAD_RECORD_THREADS
+    pthread_mutex_lock(&recorder->mutex);
+    recorder->pending++;
+    recorder->fill = (recorder->fill + 1) % NK_GAMEPAD_RECORD_CHUNKS;
+    pthread_cond_broadcast(&recorder->cond);
+
+    // Only wait if the writer has fallen behind by every chunk.
+    if (recorder->pending == NK_GAMEPAD_RECORD_CHUNKS) {
+        recorder->stalls++;
+        while (recorder->pending == NK_GAMEPAD_RECORD_CHUNKS) {
+            pthread_cond_wait(&recorder->cond, &recorder->mutex);
+        }
+    }
+    pthread_mutex_unlock(&recorder->mutex);
+#else
+    fwrite(recorder->chunks[recorder->fill], 1, (size_t)recorder->chunk_size[recorder->fill], recorder->file);
+#endif
+
+    recorder->chunk_size[recorder->fill] = 0;
+}
+
+static void nk_gamepad_recorder_write(struct nk_gamepad_recorder* recorder, const unsigned char* data, int size) {
+    if (recorder->chunk_size[recorder->fill] + size > NK_GAMEPAD_RECORD_CHUNK_SIZE) {
+        nk_gamepad_recorder_submit(recorder);
+    }
+
+    unsigned char* chunk = recorder->chunks[recorder->fill] + recorder->chunk_size[recorder->fill];
+    for (int i = 0; i < size; i++) {
+        chunk[i] = data[i];
+    }
+    recorder->chunk_size[recorder->fill] += size;
+}
+
+NK_API nk_bool nk_gamepad_recorder_open(struct nk_gamepad_recorder* recorder, const char* path, struct nk_gamepad_input_source source) {
+    if (recorder == NULL || path == NULL) {
+        return nk_false;
+    }
+
+    nk_zero(recorder, sizeof(struct nk_gamepad_recorder));
+    recorder->source = source;
+    recorder->file = fopen(path, "wb");
+    if (recorder->file == NULL) {
+        return nk_false;
+    }
+
+#ifdef NK_GAMEPAD_RECORD_THREADS
+    pthread_mutex_init(&recorder->mutex, NULL);
+    pthread_cond_init(&recorder->cond, NULL);
+    if (pthread_create(&recorder->thread, NULL, &nk_gamepad_recorder_thread, recorder) != 0) {
+        pthread_cond_destroy(&recorder->cond);
+        pthread_mutex_destroy(&recorder->mutex);
+        fclose(recorder->file);
+        recorder->file = NULL;
+        return nk_false;
+    }
+#endif
+
+    unsigned char header[16] = { 'N', 'K', 'G', 'P', 1 };
+    int size = 5 + nk_gamepad_record_write_varint(&header[5], NK_GAMEPAD_MAX);
+    nk_gamepad_recorder_write(recorder, header, size);
+
+    return nk_true;
+}
+
+NK_API void nk_gamepad_recorder_close(struct nk_gamepad_recorder* recorder) {
+    if (recorder == NULL || recorder->file == NULL) {
+        return;
+    }
+
+    // The end marker carries the trailing frames that had no changes.
+    unsigned char end[10];
+    int size = nk_gamepad_record_write_varint(end, recorder->skip);
+    size += nk_gamepad_record_write_varint(&end[size], 0);
+    nk_gamepad_recorder_write(recorder, end, size);
+    nk_gamepad_recorder_submit(recorder);
+
+#ifdef NK_GAMEPAD_RECORD_THREADS
+    pthread_mutex_lock(&recorder->mutex);
+    recorder->stop = nk_true;
+    pthread_cond_broadcast(&recorder->cond);
+    pthread_mutex_unlock(&recorder->mutex);
+    pthread_join(recorder->thread, NULL);
+    pthread_cond_destroy(&recorder->cond);
+    pthread_mutex_destroy(&recorder->mutex);
+#endif
+
+    fclose(recorder->file);
+    recorder->file = NULL;
+}
+
+static nk_bool nk_gamepad_recorder_init(struct nk_gamepads* gamepads, void* user_data) {
+    struct nk_gamepad_recorder* recorder = (struct nk_gamepad_recorder*)user_data;
+    if (recorder->source.init) {
+        return recorder->source.init(gamepads, recorder->source.user_data);
+    }
+    return nk_true;
+}
+
+static void nk_gamepad_recorder_update(struct nk_gamepads* gamepads, void* user_data) {
+    struct nk_gamepad_recorder* recorder = (struct nk_gamepad_recorder*)user_data;
+    if (recorder->source.update) {
+        recorder->source.update(gamepads, recorder->source.user_data);
+    }
+    if (recorder->file == NULL) {
+        return;
+    }
+
+    // Encode the frame on the stack, so it lands in a single chunk.
+    unsigned char frame[NK_GAMEPAD_RECORD_FRAME_SIZE];
+    int size = 0;
+    int changes = 0;
+    int last = 0;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        unsigned int state = gamepads->gamepads[num].buttons;
+        if (gamepads->gamepads[num].available) {
+            state |= NK_GAMEPAD_RECORD_AVAILABLE;
+        }
+
+        unsigned int delta = state ^ recorder->state[num];
+        if (delta == 0) {
+            continue;
+        }
+
+        size += nk_gamepad_record_write_varint(&frame[10 + size], (unsigned int)(num - last));
+        size += nk_gamepad_record_write_varint(&frame[10 + size], delta);
+        recorder->state[num] = state;
+        last = num;
+        changes++;
+    }
+    recorder->frames++;
+
+    if (changes == 0) {
+        recorder->skip++;
+        return;
+    }
+
+    // Prefix the frame with the skipped frames and the change count.
+    unsigned char prefix[10];
+    int prefix_size = nk_gamepad_record_write_varint(prefix, recorder->skip);
+    prefix_size += nk_gamepad_record_write_varint(&prefix[prefix_size], (unsigned int)changes);
+    for (int i = 0; i < prefix_size; i++) {
+        frame[10 - prefix_size + i] = prefix[i];
+    }
+    nk_gamepad_recorder_write(recorder, &frame[10 - prefix_size], prefix_size + size);
+    recorder->skip = 0;
+}
+
+static void nk_gamepad_recorder_free(struct nk_gamepads* gamepads, void* user_data) {
+    struct nk_gamepad_recorder* recorder = (struct nk_gamepad_recorder*)user_data;
+    if (recorder->source.free) {
+        recorder->source.free(gamepads, recorder->source.user_data);
+    }
+    nk_gamepad_recorder_close(recorder);
+}
+
+static const char* nk_gamepad_recorder_name(struct nk_gamepads* gamepads, int num, void* user_data) {
+    struct nk_gamepad_recorder* recorder = (struct nk_gamepad_recorder*)user_data;
+    if (recorder->source.name) {
+        return recorder->source.name(gamepads, num, recorder->source.user_data);
+    }
+    return gamepads->gamepads[num].name;
+}
+
+NK_API struct nk_gamepad_input_source nk_gamepad_recorder_input_source(struct nk_gamepad_recorder* recorder) {
+    struct nk_gamepad_input_source source = {
+        .user_data = recorder,
+        .init = &nk_gamepad_recorder_init,
+        .update = &nk_gamepad_recorder_update,
+        .free = &nk_gamepad_recorder_free,
+        .name = &nk_gamepad_recorder_name,
+        .persistent = recorder->source.persistent,
+    };
+    return source;
+}
+
+static void nk_gamepad_replay_rewind(struct nk_gamepad_replay* replay) {
+    replay->pos = replay->start;
+    replay->has_frame = nk_false;
+    replay->finished = nk_false;
+    replay->frame = 0;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        replay->state[num] = 0;
+    }
+}
+
+/**
+ * Read the trace header, and get ready to play the first frame.
+ */
+static nk_bool nk_gamepad_replay_load(struct nk_gamepad_replay* replay, const unsigned char* data, size_t size) {
+    replay->data = data;
+    replay->size = size;
+
+    unsigned int count;
+    replay->pos = 5;
+    if (size < 6 || data[0] != 'N' || data[1] != 'K' || data[2] != 'G' || data[3] != 'P' || data[4] != 1 ||
+        !nk_gamepad_record_read_varint(data, size, &replay->pos, &count)) {
+        return nk_false;
+    }
+
+    replay->count = (int)count;
+    replay->start = replay->pos;
+    nk_gamepad_replay_rewind(replay);
+    return nk_true;
+}
+
+NK_API nk_bool nk_gamepad_replay_open_memory(struct nk_gamepad_replay* replay, const void* data, size_t size) {
+    if (replay == NULL || data == NULL) {
+        return nk_false;
+    }
+
+    nk_zero(replay, sizeof(struct nk_gamepad_replay));
+    if (!nk_gamepad_replay_load(replay, (const unsigned char*)data, size)) {
+        replay->finished = nk_true;
+        return nk_false;
+    }
+
+    return nk_true;
+}
+
+NK_API nk_bool nk_gamepad_replay_open_file(struct nk_gamepad_replay* replay, const char* path) {
+    if (replay == NULL || path == NULL) {
+        return nk_false;
+    }
+    nk_zero(replay, sizeof(struct nk_gamepad_replay));
+
+#ifdef NK_GAMEPAD_RECORD_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return nk_false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return nk_false;
+    }
+
+    void* mapped = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        return nk_false;
+    }
+    replay->mapped = mapped;
+    replay->mapped_size = (size_t)info.st_size;
+#else
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        return nk_false;
+    }
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (length <= 0) {
+        fclose(file);
+        return nk_false;
+    }
+    replay->mapped = NK_GAMEPAD_MALLOC((size_t)length);
+    if (replay->mapped == NULL) {
+        fclose(file);
+        return nk_false;
+    }
+    replay->mapped_size = fread(replay->mapped, 1, (size_t)length, file);
+    fclose(file);
+#endif
+
+    if (!nk_gamepad_replay_load(replay, (const unsigned char*)replay->mapped, replay->mapped_size)) {
+        nk_gamepad_replay_close(replay);
+        return nk_false;
+    }
+
+    return nk_true;
+}
+
+NK_API void nk_gamepad_replay_close(struct nk_gamepad_replay* replay) {
+    if (replay == NULL) {
+        return;
+    }
+
+    if (replay->mapped != NULL) {
+#ifdef NK_GAMEPAD_RECORD_MMAP
+        munmap(replay->mapped, replay->mapped_size);
+#else
+        NK_GAMEPAD_FREE(replay->mapped);
+#endif
+    }
+
+    nk_zero(replay, sizeof(struct nk_gamepad_replay));
+    replay->finished = nk_true;
+}
+
+NK_API nk_bool nk_gamepad_replay_finished(struct nk_gamepad_replay* replay) {
+    return replay == NULL || replay->finished;
+}
+
+static nk_bool nk_gamepad_replay_init(struct nk_gamepads* gamepads, void* user_data) {
+    NK_UNUSED(user_data);
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        gamepads->gamepads[num].available = nk_false;
+    }
+    return nk_true;
+}
+
+/**
+ * Step the replay forward by one frame.
+ */
+static void nk_gamepad_replay_step(struct nk_gamepad_replay* replay) {
+    // Looping starts over at most once per step, so a trace without any frames finishes rather than rewinding forever.
+    nk_bool rewound = nk_false;
+    for (;;) {
+        if (replay->finished) {
+            return;
+        }
+
+        if (!replay->has_frame) {
+            if (!nk_gamepad_record_read_varint(replay->data, replay->size, &replay->pos, &replay->skip) ||
+                !nk_gamepad_record_read_varint(replay->data, replay->size, &replay->pos, &replay->changes)) {
+                // A truncated trace ends where it was cut.
+                replay->finished = nk_true;
+                return;
+            }
+            replay->has_frame = nk_true;
+        }
+
+        replay->frame++;
+        if (replay->skip > 0) {
+            replay->skip--;
+            return;
+        }
+
+        if (replay->changes == 0) {
+            replay->frame--;
+            if (replay->loop && !rewound) {
+                nk_gamepad_replay_rewind(replay);
+                rewound = nk_true;
+                continue;
+            }
+            replay->finished = nk_true;
+            return;
+        }
+
+        unsigned int num = 0;
+        for (unsigned int i = 0; i < replay->changes; i++) {
+            unsigned int delta_num, delta;
+            if (!nk_gamepad_record_read_varint(replay->data, replay->size, &replay->pos, &delta_num) ||
+                !nk_gamepad_record_read_varint(replay->data, replay->size, &replay->pos, &delta)) {
+                replay->finished = nk_true;
+                return;
+            }
+            num += delta_num;
+            if (num < NK_GAMEPAD_MAX) {
+                replay->state[num] ^= delta;
+            }
+        }
+        replay->has_frame = nk_false;
+        return;
+    }
+}
+
+static void nk_gamepad_replay_update(struct nk_gamepads* gamepads, void* user_data) {
+    struct nk_gamepad_replay* replay = (struct nk_gamepad_replay*)user_data;
+    nk_gamepad_replay_step(replay);
+
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        unsigned int state = replay->state[num];
+        gamepads->gamepads[num].available = (state & NK_GAMEPAD_RECORD_AVAILABLE) ? nk_true : nk_false;
+        gamepads->gamepads[num].buttons = state & ~NK_GAMEPAD_RECORD_AVAILABLE;
+    }
+}
+
+NK_API struct nk_gamepad_input_source nk_gamepad_replay_input_source(struct nk_gamepad_replay* replay) {
+    struct nk_gamepad_input_source source = {
+        .user_data = replay,
+        .init = &nk_gamepad_replay_init,
+        .update = &nk_gamepad_replay_update,
+    };
+    return source;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+#endif
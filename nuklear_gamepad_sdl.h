@@ -33,22 +33,29 @@ extern "C" {
 NK_API void nk_gamepad_sdl_handle_event(struct nk_gamepads* gamepads, SDL_Event *event) {
     switch (event->type) {
         case SDL_CONTROLLERDEVICEADDED: {
+            NK_GAMEPAD_TRACE_COUNT(gamepads, events, 1);
             int which = event->cdevice.which;
             if (which < NK_GAMEPAD_MAX && SDL_IsGameController(which)) {
                 SDL_GameController* controller = SDL_GameControllerOpen(which);
                 if (controller) {
                     gamepads->gamepads[which].data = controller;
                     gamepads->gamepads[which].available = nk_true;
+                    NK_GAMEPAD_JOURNAL_WRITE(gamepads, which, "sdl", NK_GAMEPAD_JOURNAL_CONNECTED, 0);
+                }
+                else {
+                    NK_GAMEPAD_JOURNAL_WRITE(gamepads, which, "sdl", NK_GAMEPAD_JOURNAL_OPEN_FAILED, 0);
                 }
             }
             break;
         }
         case SDL_CONTROLLERDEVICEREMOVED: {
+            NK_GAMEPAD_TRACE_COUNT(gamepads, events, 1);
             int which = event->cdevice.which;
             if (which < NK_GAMEPAD_MAX && gamepads->gamepads[which].data) {
                 SDL_GameControllerClose(gamepads->gamepads[which].data);
                 gamepads->gamepads[which].data = NULL;
                 gamepads->gamepads[which].available = nk_false;
+                NK_GAMEPAD_JOURNAL_WRITE(gamepads, which, "sdl", NK_GAMEPAD_JOURNAL_DISCONNECTED, 0);
             }
             break;
         }
@@ -67,8 +74,10 @@ NK_API nk_bool nk_gamepad_sdl_init(struct nk_gamepads* gamepads, void* user_data
             if (controller != NULL) {
                 gamepads->gamepads[i].data = controller;
                 gamepads->gamepads[i].available = nk_true;
+                NK_GAMEPAD_JOURNAL_WRITE(gamepads, i, "sdl", NK_GAMEPAD_JOURNAL_CONNECTED, 0);
                 continue;
             }
+            NK_GAMEPAD_JOURNAL_WRITE(gamepads, i, "sdl", NK_GAMEPAD_JOURNAL_OPEN_FAILED, 0);
         }
 
         gamepads->gamepads[i].data = NULL;
@@ -119,12 +128,17 @@ NK_API void nk_gamepad_sdl_update(struct nk_gamepads* gamepads, void* user_data)
             continue;
         }
 
+        NK_GAMEPAD_TRACE_COUNT(gamepads, pads_scanned, 1);
         SDL_GameController* controller = (SDL_GameController*)gamepads->gamepads[num].data;
+        unsigned int buttons = 0;
         for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
             if (SDL_GameControllerGetButton(controller, nk_gamepad_sdl_map_button(i))) {
-                nk_gamepad_button(gamepads, num, (enum nk_gamepad_button)i, nk_true);
+                buttons |= NK_GAMEPAD_BUTTON_FLAG(i);
             }
         }
+
+        // Only open controllers have data, so the gamepad is known to be available.
+        NK_GAMEPAD_SET_BUTTONS(gamepads, num, buttons);
     }
 }
 
@@ -149,6 +163,7 @@ NK_API struct nk_gamepad_input_source nk_gamepad_sdl_input_soure(void* user_data
         &nk_gamepad_sdl_update,
         &nk_gamepad_sdl_free,
         &nk_gamepad_sdl_name,
+        nk_false,
     };
     return source;
 }
@@ -0,0 +1,143 @@
+#ifndef NUKLEAR_GAMEPAD_STRESS_H__
+#define NUKLEAR_GAMEPAD_STRESS_H__
+
+/**
+ * State of the synthetic stress input source.
+ *
+ * Each released button is pressed with the given chance every update, and then held for a number of updates
+ * picked uniformly between hold_min and hold_max. The same seed always produces the same traffic.
+ *
+ * @see nk_gamepad_stress_setup()
+ */
+struct nk_gamepad_stress {
+    unsigned long long rng; /** The PRNG state. */
+    int pads; /** How many gamepads are connected, starting from the first. */
+    unsigned int press_chance; /** The chance of a press each update, out of 65536. */
+    unsigned int hold_min; /** The fewest updates a press is held for. */
+    unsigned int hold_max; /** The most updates a press is held for. */
+    unsigned int buttons[NK_GAMEPAD_MAX];
+    unsigned int hold[NK_GAMEPAD_MAX][NK_GAMEPAD_BUTTON_LAST]; /** Updates left before each button is released. */
+    unsigned long long presses; /** Total amount of presses generated. */
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Set up the stress input source.
+ *
+ * @param stress The state to set up.
+ * @param seed The PRNG seed.
+ * @param pads How many gamepads to drive, or -1 for all of them.
+ * @param press_rate The chance, from 0 to 1, of each released button being pressed each update.
+ * @param hold_min The fewest updates a press is held for, at least 1.
+ * @param hold_max The most updates a press is held for.
+ */
+NK_API void nk_gamepad_stress_setup(struct nk_gamepad_stress* stress, unsigned long long seed, int pads, float press_rate, unsigned int hold_min, unsigned int hold_max);
+
+/**
+ * An input source that generates deterministic pseudo-random button traffic, for load testing without devices.
+ *
+ * @param stress [nk_gamepad_stress] The state, set up with nk_gamepad_stress_setup().
+ */
+NK_API struct nk_gamepad_input_source nk_gamepad_stress_input_source(struct nk_gamepad_stress* stress);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#if defined(NK_GAMEPAD_IMPLEMENTATION) && !defined(NK_GAMEPAD_HEADER_ONLY)
+#ifndef NUKLEAR_GAMEPAD_STRESS_IMPLEMENTATION_ONCE
+#define NUKLEAR_GAMEPAD_STRESS_IMPLEMENTATION_ONCE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * xorshift64* PRNG, returning the high 32 bits.
+ */
+static unsigned int nk_gamepad_stress_random(struct nk_gamepad_stress* stress) {
+    stress->rng ^= stress->rng >> 12;
+    stress->rng ^= stress->rng << 25;
+    stress->rng ^= stress->rng >> 27;
+    return (unsigned int)((stress->rng * 2685821657736338717ULL) >> 32);
+}
+
+NK_API void nk_gamepad_stress_setup(struct nk_gamepad_stress* stress, unsigned long long seed, int pads, float press_rate, unsigned int hold_min, unsigned int hold_max) {
+    if (stress == NULL) {
+        return;
+    }
+
+    nk_zero(stress, sizeof(struct nk_gamepad_stress));
+
+    // The PRNG state can't be zero.
+    stress->rng = (seed == 0) ? 0x9E3779B97F4A7C15ULL : seed;
+    stress->pads = (pads < 0 || pads > NK_GAMEPAD_MAX) ? NK_GAMEPAD_MAX : pads;
+    if (press_rate <= 0.0f) {
+        stress->press_chance = 0;
+    }
+    else if (press_rate >= 1.0f) {
+        stress->press_chance = 65536;
+    }
+    else {
+        stress->press_chance = (unsigned int)(press_rate * 65536.0f);
+    }
+    stress->hold_min = (hold_min < 1) ? 1 : hold_min;
+    stress->hold_max = (hold_max < stress->hold_min) ? stress->hold_min : hold_max;
+}
+
+static nk_bool nk_gamepad_stress_init(struct nk_gamepads* gamepads, void* user_data) {
+    struct nk_gamepad_stress* stress = (struct nk_gamepad_stress*)user_data;
+    if (stress == NULL) {
+        return nk_false;
+    }
+
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        gamepads->gamepads[num].available = num < stress->pads;
+    }
+    return nk_true;
+}
+
+static void nk_gamepad_stress_update(struct nk_gamepads* gamepads, void* user_data) {
+    struct nk_gamepad_stress* stress = (struct nk_gamepad_stress*)user_data;
+    unsigned int hold_range = stress->hold_max - stress->hold_min + 1;
+
+    for (int num = 0; num < stress->pads; num++) {
+        unsigned int buttons = stress->buttons[num];
+        for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
+            if (buttons & NK_GAMEPAD_BUTTON_FLAG(i)) {
+                if (--stress->hold[num][i] == 0) {
+                    buttons &= ~(unsigned int)NK_GAMEPAD_BUTTON_FLAG(i);
+                }
+            }
+            else if ((nk_gamepad_stress_random(stress) & 0xFFFF) < stress->press_chance) {
+                buttons |= NK_GAMEPAD_BUTTON_FLAG(i);
+                stress->hold[num][i] = stress->hold_min + nk_gamepad_stress_random(stress) % hold_range;
+                stress->presses++;
+            }
+        }
+
+        stress->buttons[num] = buttons;
+        gamepads->gamepads[num].buttons = buttons;
+    }
+}
+
+NK_API struct nk_gamepad_input_source nk_gamepad_stress_input_source(struct nk_gamepad_stress* stress) {
+    struct nk_gamepad_input_source source = {
+        .user_data = stress,
+        .init = &nk_gamepad_stress_init,
+        .update = &nk_gamepad_stress_update,
+    };
+    return source;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+#endif
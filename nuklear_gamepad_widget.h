@@ -0,0 +1,171 @@
+#ifndef NUKLEAR_GAMEPAD_WIDGET_H__
+#define NUKLEAR_GAMEPAD_WIDGET_H__
+
+/**
+ * The controller layout of nk_gamepad_widget(), scaled to a widget size.
+ *
+ * @internal
+ */
+struct nk_gamepad_widget_geometry {
+    float width;
+    float height;
+    float unit; /** The size of one layout unit, in pixels. */
+    struct nk_rect body;
+    struct nk_rect sticks[2];
+    struct nk_rect buttons[NK_GAMEPAD_BUTTON_LAST];
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Draw a whole controller, with its held buttons highlighted, as a single widget.
+ *
+ * The d-pad, face buttons, shoulders, menu buttons and sticks are drawn straight to the window canvas, and the
+ * layout is only recalculated when the widget size changes, so many gamepads can be shown at little cost. Sticks
+ * are drawn as outlines, since analog input isn't tracked.
+ *
+ * @param ctx The Nuklear context.
+ * @param gamepads The associated gamepad system.
+ * @param num The gamepad number.
+ *
+ * @return True if the widget was drawn, false if the gamepad number is invalid or the widget is clipped.
+ *
+ * @code
+ * nk_layout_row_dynamic(ctx, 120, 4);
+ * for (int i = 0; i < nk_gamepad_count(gamepads); i++) {
+ *   nk_gamepad_widget(ctx, gamepads, i);
+ * }
+ * @endcode
+ */
+NK_API nk_bool nk_gamepad_widget(struct nk_context* ctx, struct nk_gamepads* gamepads, int num);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#if defined(NK_GAMEPAD_IMPLEMENTATION) && !defined(NK_GAMEPAD_HEADER_ONLY)
+#ifndef NUKLEAR_GAMEPAD_WIDGET_IMPLEMENTATION_ONCE
+#define NUKLEAR_GAMEPAD_WIDGET_IMPLEMENTATION_ONCE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The controller layout, in units of a 16 by 10 grid.
+ */
+static const struct nk_rect nk_gamepad_widget_layout[NK_GAMEPAD_BUTTON_LAST] = {
+    {3.3f, 2.4f, 1.4f, 1.6f}, // UP
+    {3.3f, 5.4f, 1.4f, 1.6f}, // DOWN
+    {1.6f, 4.0f, 1.7f, 1.4f}, // LEFT
+    {4.7f, 4.0f, 1.7f, 1.4f}, // RIGHT
+    {11.3f, 5.6f, 1.4f, 1.4f}, // A
+    {13.0f, 3.9f, 1.4f, 1.4f}, // B
+    {9.6f, 3.9f, 1.4f, 1.4f}, // X
+    {11.3f, 2.2f, 1.4f, 1.4f}, // Y
+    {1.5f, 0.0f, 3.5f, 0.9f}, // LB
+    {11.0f, 0.0f, 3.5f, 0.9f}, // RB
+    {6.0f, 3.0f, 1.2f, 0.7f}, // BACK
+    {8.8f, 3.0f, 1.2f, 0.7f}, // START
+    {7.4f, 2.8f, 1.2f, 1.2f}, // GUIDE
+};
+
+/**
+ * Scale the layout to the widget size, keeping its aspect ratio and centering it.
+ */
+static void nk_gamepad_widget_measure(struct nk_gamepad_widget_geometry* geometry, float width, float height) {
+    const float unit = NK_MIN(width / 16.0f, height / 10.0f);
+    const float x = (width - unit * 16.0f) / 2.0f;
+    const float y = (height - unit * 10.0f) / 2.0f;
+    const struct nk_rect sticks[2] = {{4.6f, 6.8f, 2.2f, 2.2f}, {9.2f, 6.8f, 2.2f, 2.2f}};
+
+    geometry->width = width;
+    geometry->height = height;
+    geometry->unit = unit;
+    geometry->body = nk_rect(x + 0.5f * unit, y + 1.0f * unit, 15.0f * unit, 8.6f * unit);
+    for (int i = 0; i < 2; i++) {
+        geometry->sticks[i] = nk_rect(x + sticks[i].x * unit, y + sticks[i].y * unit, sticks[i].w * unit, sticks[i].h * unit);
+    }
+    for (int i = 0; i < NK_GAMEPAD_BUTTON_LAST; i++) {
+        const struct nk_rect* shape = &nk_gamepad_widget_layout[i];
+        geometry->buttons[i] = nk_rect(x + shape->x * unit, y + shape->y * unit, shape->w * unit, shape->h * unit);
+    }
+}
+
+static struct nk_rect nk_gamepad_widget_offset(struct nk_rect rect, struct nk_rect bounds) {
+    return nk_rect(bounds.x + rect.x, bounds.y + rect.y, rect.w, rect.h);
+}
+
+NK_API nk_bool nk_gamepad_widget(struct nk_context* ctx, struct nk_gamepads* gamepads, int num) {
+    // Every widget of the same size shares the layout.
+    static struct nk_gamepad_widget_geometry geometry;
+
+    if (ctx == NULL || gamepads == NULL || num < 0 || num >= NK_GAMEPAD_MAX) {
+        return nk_false;
+    }
+
+    struct nk_rect bounds;
+    if (nk_widget(&bounds, ctx) == NK_WIDGET_INVALID) {
+        return nk_false;
+    }
+
+    if (geometry.width != bounds.w || geometry.height != bounds.h) {
+        nk_gamepad_widget_measure(&geometry, bounds.w, bounds.h);
+    }
+
+    struct nk_command_buffer* canvas = nk_window_get_canvas(ctx);
+    const struct nk_style_button* style = &ctx->style.button;
+    const struct nk_gamepad* gamepad = &gamepads->gamepads[num];
+    const struct nk_color outline = ctx->style.window.border_color;
+    const struct nk_color normal = gamepad->available ? style->normal.data.color : ctx->style.window.background;
+    const struct nk_color down = style->active.data.color;
+    const float rounding = geometry.unit;
+
+    nk_stroke_rect(canvas, nk_gamepad_widget_offset(geometry.body, bounds), rounding * 2.0f, 1.0f, outline);
+    for (int i = 0; i < 2; i++) {
+        nk_stroke_circle(canvas, nk_gamepad_widget_offset(geometry.sticks[i], bounds), 1.0f, outline);
+    }
+
+    for (int button = 0; button < NK_GAMEPAD_BUTTON_LAST; button++) {
+        struct nk_rect rect = nk_gamepad_widget_offset(geometry.buttons[button], bounds);
+        struct nk_color color = (gamepad->buttons & NK_GAMEPAD_BUTTON_FLAG(button)) ? down : normal;
+        switch (button) {
+            case NK_GAMEPAD_BUTTON_A:
+            case NK_GAMEPAD_BUTTON_B:
+            case NK_GAMEPAD_BUTTON_X:
+            case NK_GAMEPAD_BUTTON_Y:
+            case NK_GAMEPAD_BUTTON_GUIDE:
+                nk_fill_circle(canvas, rect, color);
+                break;
+            default:
+                nk_fill_rect(canvas, rect, rounding * 0.3f, color);
+                break;
+        }
+    }
+
+    // Only label the face buttons when the text fits.
+    const struct nk_user_font* font = ctx->style.font;
+    if (font != NULL && font->height <= geometry.buttons[NK_GAMEPAD_BUTTON_A].h) {
+        static const char labels[4] = {'A', 'B', 'X', 'Y'};
+        for (int i = 0; i < 4; i++) {
+            struct nk_rect rect = nk_gamepad_widget_offset(geometry.buttons[NK_GAMEPAD_BUTTON_A + i], bounds);
+            float width = font->width(font->userdata, font->height, &labels[i], 1);
+            rect.x += (rect.w - width) / 2.0f;
+            rect.y += (rect.h - font->height) / 2.0f;
+            nk_draw_text(canvas, rect, &labels[i], 1, font, nk_rgba(0, 0, 0, 0), style->text_normal);
+        }
+    }
+
+    return nk_true;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // NUKLEAR_GAMEPAD_WIDGET_IMPLEMENTATION_ONCE
+#endif  // NK_GAMEPAD_IMPLEMENTATION
@@ -0,0 +1,166 @@
+#include <assert.h>
+#include <stdio.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_ACTIONS
+#include "../nuklear_gamepad.h"
+#include "nuklear_gamepad_test_source.h"
+
+enum test_action {
+    TEST_ACTION_CONFIRM,
+    TEST_ACTION_CANCEL,
+    TEST_ACTION_PAGE_NEXT,
+    TEST_ACTION_COUNT
+};
+
+static const char* test_actions[TEST_ACTION_COUNT] = {
+    "confirm",
+    "cancel",
+    "page_next",
+};
+
+int main() {
+    printf("nuklear_gamepad_actions_test\n");
+    printf("----------------------------\n");
+
+    struct nk_gamepads gamepads;
+    assert(test_source_init(&gamepads, NULL) == nk_true);
+
+    struct nk_gamepad_action_set menu;
+    struct nk_gamepad_action_set game;
+
+    printf("nk_gamepad_action_set_init()\n");
+    {
+        assert(nk_gamepad_action_set_init(NULL, test_actions, TEST_ACTION_COUNT) == nk_false);
+        assert(nk_gamepad_action_set_init(&menu, NULL, TEST_ACTION_COUNT) == nk_false);
+        assert(nk_gamepad_action_set_init(&menu, test_actions, NK_GAMEPAD_ACTIONS_MAX + 1) == nk_false);
+        const char* missing[] = {"confirm", NULL};
+        assert(nk_gamepad_action_set_init(&menu, missing, 2) == nk_false);
+        assert(nk_gamepad_action_set_init(&menu, test_actions, TEST_ACTION_COUNT) == nk_true);
+        assert(nk_gamepad_action_set_init(&game, test_actions, TEST_ACTION_COUNT) == nk_true);
+    }
+
+    printf("nk_gamepad_action_find()\n");
+    {
+        assert(nk_gamepad_action_find(&menu, "confirm") == TEST_ACTION_CONFIRM);
+        assert(nk_gamepad_action_find(&game, "page_next") == TEST_ACTION_PAGE_NEXT);
+        assert(nk_gamepad_action_find(&menu, "page") == -1);
+        assert(nk_gamepad_action_find(&menu, "page_next_") == -1);
+        assert(nk_gamepad_action_find(&menu, NULL) == -1);
+        assert(nk_gamepad_action_find(NULL, "confirm") == -1);
+    }
+
+    printf("nk_gamepad_action_bind()\n");
+    {
+        nk_gamepad_action_bind(&menu, TEST_ACTION_CONFIRM, -1, NK_GAMEPAD_BUTTON_A);
+        nk_gamepad_action_bind(&menu, TEST_ACTION_CONFIRM, -1, NK_GAMEPAD_BUTTON_START);
+        nk_gamepad_action_bind(&menu, TEST_ACTION_CANCEL, -1, NK_GAMEPAD_BUTTON_B);
+        nk_gamepad_action_bind(&menu, TEST_ACTION_PAGE_NEXT, 1, NK_GAMEPAD_BUTTON_RB);
+        assert(menu.masks[TEST_ACTION_CONFIRM][0] == (unsigned int)(NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_START)));
+        assert(menu.masks[TEST_ACTION_CONFIRM][NK_GAMEPAD_MAX - 1] == menu.masks[TEST_ACTION_CONFIRM][0]);
+        assert(menu.masks[TEST_ACTION_PAGE_NEXT][0] == 0);
+        assert(menu.masks[TEST_ACTION_PAGE_NEXT][1] == (unsigned int)NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_RB));
+
+        // The in game set binds the same actions differently.
+        nk_gamepad_action_bind(&game, TEST_ACTION_CONFIRM, -1, NK_GAMEPAD_BUTTON_X);
+
+        // Invalid arguments are ignored.
+        nk_gamepad_action_bind(NULL, TEST_ACTION_CONFIRM, -1, NK_GAMEPAD_BUTTON_Y);
+        nk_gamepad_action_bind(&game, TEST_ACTION_COUNT, -1, NK_GAMEPAD_BUTTON_Y);
+        nk_gamepad_action_bind(&game, TEST_ACTION_CANCEL, NK_GAMEPAD_MAX, NK_GAMEPAD_BUTTON_Y);
+        nk_gamepad_action_bind(&game, TEST_ACTION_CANCEL, -1, NK_GAMEPAD_BUTTON_LAST);
+        nk_gamepad_action_bind(&game, TEST_ACTION_CANCEL, -1, NK_GAMEPAD_BUTTON_INVALID);
+        assert(game.masks[TEST_ACTION_CANCEL][0] == 0);
+    }
+
+    printf("nk_gamepad_is_action_pressed()\n");
+    {
+        // Nothing is checked without an action set.
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_action_pressed(&gamepads, 0, TEST_ACTION_CONFIRM) == nk_false);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+
+        nk_gamepad_set_action_set(&gamepads, &menu);
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_action_pressed(&gamepads, 0, TEST_ACTION_CONFIRM) == nk_true);
+        assert(nk_gamepad_is_action_pressed(&gamepads, -1, TEST_ACTION_CONFIRM) == nk_true);
+        assert(nk_gamepad_is_action_pressed(&gamepads, 1, TEST_ACTION_CONFIRM) == nk_false);
+        assert(nk_gamepad_is_action_pressed(&gamepads, 0, TEST_ACTION_CANCEL) == nk_false);
+        assert(nk_gamepad_is_action_down(&gamepads, 0, TEST_ACTION_CONFIRM) == nk_true);
+
+        // Pressing a second bound button while the first is held isn't another press.
+        test_buttons[0] |= NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_START);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_action_pressed(&gamepads, 0, TEST_ACTION_CONFIRM) == nk_false);
+        assert(nk_gamepad_is_action_down(&gamepads, 0, TEST_ACTION_CONFIRM) == nk_true);
+
+        // Nor is letting go of one of them a release.
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_START);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_action_released(&gamepads, 0, TEST_ACTION_CONFIRM) == nk_false);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_action_released(&gamepads, 0, TEST_ACTION_CONFIRM) == nk_true);
+        assert(nk_gamepad_is_action_released(&gamepads, -1, TEST_ACTION_CONFIRM) == nk_true);
+        assert(nk_gamepad_is_action_down(&gamepads, -1, TEST_ACTION_CONFIRM) == nk_false);
+
+        // Bindings for a single gamepad.
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_RB);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_action_pressed(&gamepads, -1, TEST_ACTION_PAGE_NEXT) == nk_false);
+        test_buttons[0] = 0;
+        test_buttons[1] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_RB);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_action_pressed(&gamepads, -1, TEST_ACTION_PAGE_NEXT) == nk_true);
+        test_buttons[1] = 0;
+        nk_gamepad_update(&gamepads);
+
+        // Switching sets changes what the buttons mean.
+        nk_gamepad_set_action_set(&gamepads, &game);
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_action_pressed(&gamepads, 0, TEST_ACTION_CONFIRM) == nk_false);
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_X);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_action_pressed(&gamepads, 0, TEST_ACTION_CONFIRM) == nk_true);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+
+        // Invalid arguments.
+        assert(nk_gamepad_is_action_pressed(NULL, 0, TEST_ACTION_CONFIRM) == nk_false);
+        assert(nk_gamepad_is_action_pressed(&gamepads, NK_GAMEPAD_MAX, TEST_ACTION_CONFIRM) == nk_false);
+        assert(nk_gamepad_is_action_pressed(&gamepads, 0, -1) == nk_false);
+        assert(nk_gamepad_is_action_pressed(&gamepads, 0, TEST_ACTION_COUNT) == nk_false);
+    }
+
+    printf("nk_gamepad_action_unbind()\n");
+    {
+        nk_gamepad_set_action_set(&gamepads, &menu);
+        nk_gamepad_action_unbind(&menu, TEST_ACTION_CONFIRM, 0, NK_GAMEPAD_BUTTON_A);
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+        test_buttons[1] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_action_down(&gamepads, 0, TEST_ACTION_CONFIRM) == nk_false);
+        assert(nk_gamepad_is_action_down(&gamepads, 1, TEST_ACTION_CONFIRM) == nk_true);
+
+        nk_gamepad_action_unbind(&menu, TEST_ACTION_CONFIRM, -1, NK_GAMEPAD_BUTTON_INVALID);
+        assert(nk_gamepad_is_action_down(&gamepads, -1, TEST_ACTION_CONFIRM) == nk_false);
+        assert(menu.masks[TEST_ACTION_CONFIRM][0] == 0);
+        assert(menu.masks[TEST_ACTION_CANCEL][0] == (unsigned int)NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_B));
+    }
+
+    nk_gamepad_free(&gamepads);
+
+    printf("----------------------------\n");
+    printf("nuklear_gamepad_actions_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include <assert.h>
+#include <stdio.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_ACTIVE
+#include "../nuklear_gamepad.h"
+#include "nuklear_gamepad_test_source.h"
+
+int main() {
+    printf("nuklear_gamepad_active_test\n");
+    printf("---------------------------\n");
+
+    struct nk_context ctx;
+    nk_init_default(&ctx, 0);
+
+    struct nk_gamepads gamepads;
+    assert(test_source_init(&gamepads, &ctx) == nk_true);
+
+    printf("nk_gamepad_last_active()\n");
+    {
+        nk_gamepad_time time = 1;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_last_active(&gamepads, &time) == -1);
+        assert(time == 0);
+
+        test_buttons[1] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_last_active(&gamepads, &time) == 1);
+        assert(time == 1000);
+
+        // Holding a button doesn't count as touching the gamepad again.
+        test_time = 2000;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_last_active(&gamepads, &time) == 1);
+        assert(time == 1000);
+
+        // Releasing doesn't move it either, only pressing does.
+        test_buttons[1] = 0;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_last_active(&gamepads, NULL) == 1);
+
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_B);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_last_active(&gamepads, &time) == 0);
+        assert(time == 2000);
+
+        // Keys pressed on the Nuklear context are the keyboard.
+        test_buttons[0] = 0;
+        test_time = 3000;
+        ctx.input.keyboard.keys[NK_KEY_ENTER].down = nk_true;
+        ctx.input.keyboard.keys[NK_KEY_ENTER].clicked = 1;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_last_active(&gamepads, &time) == NK_GAMEPAD_ACTIVE_KEYBOARD);
+        assert(time == 3000);
+        ctx.input.keyboard.keys[NK_KEY_ENTER].down = nk_false;
+        ctx.input.keyboard.keys[NK_KEY_ENTER].clicked = 0;
+
+        // Text input counts as well, over gamepads pressed in the same update.
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_X);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_last_active(&gamepads, NULL) == 0);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_X);
+        ctx.input.keyboard.text[0] = 'a';
+        ctx.input.keyboard.text_len = 1;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_last_active(&gamepads, NULL) == NK_GAMEPAD_ACTIVE_KEYBOARD);
+        ctx.input.keyboard.text_len = 0;
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+
+        assert(nk_gamepad_last_active(NULL, &time) == -1);
+    }
+
+    printf("nk_gamepad_active_changed()\n");
+    {
+        test_buttons[1] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_START);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_active_changed(&gamepads) == nk_true);
+
+        // Only for the update it changed in.
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_active_changed(&gamepads) == nk_false);
+
+        // Pressing again on the same gamepad isn't a change.
+        test_buttons[1] = 0;
+        nk_gamepad_update(&gamepads);
+        test_buttons[1] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_START);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_active_changed(&gamepads) == nk_false);
+        assert(nk_gamepad_last_active(&gamepads, NULL) == 1);
+
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_UP);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_active_changed(&gamepads) == nk_true);
+
+        assert(nk_gamepad_active_changed(NULL) == nk_false);
+    }
+
+    nk_gamepad_free(&gamepads);
+    nk_free(&ctx);
+
+    printf("---------------------------\n");
+    printf("nuklear_gamepad_active_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#include "stubs/nuklear_gamepad_stubs.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#include "../nuklear_gamepad.h"
+#include "../nuklear_gamepad_sdl.h"
+#include "../nuklear_gamepad_glfw.h"
+#include "../nuklear_gamepad_raylib.h"
+#include "../nuklear_gamepad_pntr.h"
+
+#define TEST_BUTTONS_0 (NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_UP) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LB))
+#define TEST_BUTTONS_1 (NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_START) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_GUIDE) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_Y))
+#define TEST_ALL_BUTTONS (NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST) - 1)
+
+/**
+ * Two connected devices with different buttons held, and a gap at index 2.
+ */
+static void test_script(void) {
+    nk_gamepad_stub_reset();
+    nk_gamepad_stub_devices[0].connected = true;
+    nk_gamepad_stub_devices[0].buttons = TEST_BUTTONS_0;
+    nk_gamepad_stub_devices[0].name = "Stub Pad";
+    nk_gamepad_stub_devices[1].connected = true;
+    nk_gamepad_stub_devices[1].buttons = TEST_BUTTONS_1;
+    nk_gamepad_stub_devices[3].connected = true;
+    nk_gamepad_stub_devices[3].buttons = TEST_ALL_BUTTONS;
+}
+
+/**
+ * Every nuklear_gamepad button must make it through each backend's mapping.
+ */
+static void test_buttons(struct nk_gamepads* gamepads) {
+    assert(gamepads->gamepads[0].buttons == TEST_BUTTONS_0);
+    assert(gamepads->gamepads[1].buttons == TEST_BUTTONS_1);
+    assert(gamepads->gamepads[3].buttons == TEST_ALL_BUTTONS);
+    assert(nk_gamepad_is_button_pressed(gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+    assert(nk_gamepad_is_button_down(gamepads, 1, NK_GAMEPAD_BUTTON_A) == nk_false);
+}
+
+int main() {
+    printf("nuklear_gamepad_backends_test\n");
+    printf("-----------------------------\n");
+
+    printf("nk_gamepad_sdl_input_soure()\n");
+    {
+        struct nk_gamepads gamepads;
+        test_script();
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_sdl_input_soure(NULL)) == nk_true);
+        assert(nk_gamepad_is_available(&gamepads, 0) == nk_true);
+        assert(nk_gamepad_is_available(&gamepads, 2) == nk_false);
+        assert(nk_gamepad_stub_calls.sdl_open == 3);
+
+        nk_gamepad_stub_reset_calls();
+        nk_gamepad_update(&gamepads);
+        test_buttons(&gamepads);
+
+        // Only connected controllers are polled, one call per button.
+        assert(nk_gamepad_stub_calls.sdl_get_button == 3 * NK_GAMEPAD_BUTTON_LAST);
+        assert(nk_gamepad_stub_total_calls() == 3 * NK_GAMEPAD_BUTTON_LAST);
+
+        assert(strcmp(nk_gamepad_name(&gamepads, 0), "Stub Pad") == 0);
+        assert(strcmp(nk_gamepad_name(&gamepads, 1), "Controller 2") == 0);
+
+        // Hotplug events.
+        SDL_Event event;
+        event.cdevice.type = SDL_CONTROLLERDEVICEREMOVED;
+        event.cdevice.which = 1;
+        nk_gamepad_sdl_handle_event(&gamepads, &event);
+        assert(nk_gamepad_is_available(&gamepads, 1) == nk_false);
+        nk_gamepad_stub_devices[2].connected = true;
+        event.cdevice.type = SDL_CONTROLLERDEVICEADDED;
+        event.cdevice.which = 2;
+        nk_gamepad_sdl_handle_event(&gamepads, &event);
+        assert(nk_gamepad_is_available(&gamepads, 2) == nk_true);
+
+        nk_gamepad_free(&gamepads);
+        assert(nk_gamepad_stub_calls.sdl_close == 4);
+    }
+
+    printf("nk_gamepad_glfw_input_soure()\n");
+    {
+        struct nk_gamepads gamepads;
+        test_script();
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_glfw_input_soure(NULL)) == nk_true);
+        nk_gamepad_update(&gamepads);
+        test_buttons(&gamepads);
+        assert(nk_gamepad_is_available(&gamepads, 2) == nk_false);
+
+        // Every joystick is checked for presence, and connected ones have their state read once.
+        assert(nk_gamepad_stub_calls.glfw_joystick_present == NK_GAMEPAD_MAX);
+        assert(nk_gamepad_stub_calls.glfw_get_gamepad_state == 3);
+
+        nk_gamepad_stub_reset_calls();
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_stub_total_calls() == NK_GAMEPAD_MAX + 3 + 3);
+
+        assert(strcmp(nk_gamepad_name(&gamepads, 0), "Stub Pad") == 0);
+        assert(strcmp(nk_gamepad_name(&gamepads, 1), "Controller 2") == 0);
+        nk_gamepad_free(&gamepads);
+    }
+
+    printf("nk_gamepad_raylib_input_soure()\n");
+    {
+        struct nk_gamepads gamepads;
+        test_script();
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_raylib_input_soure(NULL)) == nk_true);
+        nk_gamepad_update(&gamepads);
+        test_buttons(&gamepads);
+        assert(nk_gamepad_is_available(&gamepads, 2) == nk_false);
+
+        nk_gamepad_stub_reset_calls();
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_stub_calls.raylib_is_gamepad_available == NK_GAMEPAD_MAX);
+        assert(nk_gamepad_stub_calls.raylib_is_gamepad_button_down == 3 * NK_GAMEPAD_BUTTON_LAST);
+
+        assert(strcmp(nk_gamepad_name(&gamepads, 0), "Stub Pad") == 0);
+        assert(strcmp(nk_gamepad_name(&gamepads, 1), "Controller 2") == 0);
+        nk_gamepad_free(&gamepads);
+    }
+
+    printf("nk_gamepad_pntr_input_soure()\n");
+    {
+        struct nk_gamepads gamepads;
+        test_script();
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_pntr_input_soure(nk_gamepad_stub_pntr_app())) == nk_true);
+        nk_gamepad_update(&gamepads);
+        test_buttons(&gamepads);
+
+        // pntr_app has no connection query, so every gamepad is polled for every button.
+        nk_gamepad_stub_reset_calls();
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_stub_calls.pntr_gamepad_button_down == PNTR_APP_MAX_GAMEPADS * NK_GAMEPAD_BUTTON_LAST);
+        nk_gamepad_free(&gamepads);
+    }
+
+    printf("-----------------------------\n");
+    printf("nuklear_gamepad_backends_test: Tests passed!\n");
+
+    return 0;
+}
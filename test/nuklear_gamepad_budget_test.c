@@ -0,0 +1,123 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <assert.h>
+#include <stdio.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_BUDGET
+#define NK_GAMEPAD_BUDGET_MAX_SKIP 4
+#define NK_GAMEPAD_JOURNAL
+#include "../nuklear_gamepad.h"
+
+#define TEST_BUDGET 2000000
+
+// Whether the next updates should overrun the budget, and how many updates reached the input source.
+static nk_bool test_slow = nk_false;
+static int test_polls = 0;
+
+static void test_update(struct nk_gamepads* gamepads, void* user_data) {
+    NK_UNUSED(user_data);
+    test_polls++;
+    gamepads->gamepads[0].buttons = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+    if (test_slow) {
+        nk_gamepad_time start = nk_gamepad_now();
+        while (nk_gamepad_now() - start < TEST_BUDGET * 2) {
+            // Stall like a blocking HID call.
+        }
+    }
+}
+
+/**
+ * Run an update, and report whether it reached the input source.
+ */
+static nk_bool test_poll(struct nk_gamepads* gamepads) {
+    int polls = test_polls;
+    nk_gamepad_update(gamepads);
+    return test_polls != polls;
+}
+
+int main() {
+    printf("nuklear_gamepad_budget_test\n");
+    printf("---------------------------\n");
+
+    struct nk_gamepads gamepads;
+    struct nk_gamepad_input_source source = {
+        .update = &test_update,
+    };
+    assert(nk_gamepad_init_with_source(&gamepads, NULL, source) == nk_true);
+    assert(gamepads.budget.limit == NK_GAMEPAD_BUDGET_DEFAULT);
+
+    printf("nk_gamepad_set_budget()\n");
+    {
+        nk_gamepad_set_budget(&gamepads, TEST_BUDGET);
+        assert(gamepads.budget.limit == TEST_BUDGET);
+        assert(test_poll(&gamepads) == nk_true);
+        assert(gamepads.budget.stalls == 0);
+    }
+
+    printf("nk_gamepad_update()\n");
+    {
+        // A stall skips the next poll, and the last known state stays without repeating the press.
+        test_slow = nk_true;
+        assert(test_poll(&gamepads) == nk_true);
+        assert(gamepads.budget.stalls == 1);
+        assert(gamepads.budget.last > TEST_BUDGET);
+        assert(test_poll(&gamepads) == nk_false);
+        assert(nk_gamepad_is_button_down(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+        assert(nk_gamepad_is_button_pressed(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+
+        // Each stall in a row backs off for twice as long, up to NK_GAMEPAD_BUDGET_MAX_SKIP.
+        assert(test_poll(&gamepads) == nk_true);
+        assert(test_poll(&gamepads) == nk_false);
+        assert(test_poll(&gamepads) == nk_false);
+        assert(test_poll(&gamepads) == nk_true);
+        assert(gamepads.budget.backoff == 4);
+        for (int i = 0; i < 4; i++) {
+            assert(test_poll(&gamepads) == nk_false);
+        }
+        assert(test_poll(&gamepads) == nk_true);
+        assert(gamepads.budget.backoff == 4);
+        assert(gamepads.budget.stalls == 4);
+        assert(gamepads.budget.skipped == 1 + 2 + 4);
+
+        // The stalls are journaled.
+        unsigned int cursor = 0;
+        struct nk_gamepad_journal_entry entry;
+        int stalls = 0;
+        while (nk_gamepad_journal_next(&gamepads, &cursor, &entry)) {
+            if (entry.type == NK_GAMEPAD_JOURNAL_STALL) {
+                stalls++;
+            }
+        }
+        assert(stalls == 4);
+
+        // Once the backoff is over and the input source is fast again, it is polled every update.
+        test_slow = nk_false;
+        for (int i = 0; i < 4; i++) {
+            test_poll(&gamepads);
+        }
+        assert(test_poll(&gamepads) == nk_true);
+        assert(test_poll(&gamepads) == nk_true);
+        assert(gamepads.budget.backoff == 0);
+
+        // Without a budget, slow updates are never skipped.
+        nk_gamepad_set_budget(&gamepads, 0);
+        test_slow = nk_true;
+        assert(test_poll(&gamepads) == nk_true);
+        assert(test_poll(&gamepads) == nk_true);
+    }
+
+    nk_gamepad_free(&gamepads);
+
+    printf("---------------------------\n");
+    printf("nuklear_gamepad_budget_test: Tests passed!\n");
+
+    return 0;
+}
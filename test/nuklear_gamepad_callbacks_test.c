@@ -0,0 +1,148 @@
+#include <assert.h>
+#include <stdio.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_CALLBACKS
+#define NK_GAMEPAD_CALLBACKS_MAX 4
+#include "../nuklear_gamepad.h"
+#include "nuklear_gamepad_test_source.h"
+
+/**
+ * What a callback saw.
+ */
+struct test_calls {
+    int count;
+    int num;
+    enum nk_gamepad_button button;
+    nk_bool down;
+};
+
+static void test_callback(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, nk_bool down, void* user_data) {
+    NK_UNUSED(gamepads);
+    struct test_calls* calls = (struct test_calls*)user_data;
+    calls->count++;
+    calls->num = num;
+    calls->button = button;
+    calls->down = down;
+}
+
+static int test_once_handle = -1;
+
+static void test_once(struct nk_gamepads* gamepads, int num, enum nk_gamepad_button button, nk_bool down, void* user_data) {
+    test_callback(gamepads, num, button, down, user_data);
+    nk_gamepad_remove_callback(gamepads, test_once_handle);
+}
+
+int main() {
+    printf("nuklear_gamepad_callbacks_test\n");
+    printf("------------------------------\n");
+
+    struct nk_gamepads gamepads;
+    assert(test_source_init(&gamepads, NULL) == nk_true);
+
+    struct test_calls start = {0};
+    struct test_calls any = {0};
+    struct test_calls once = {0};
+
+    printf("nk_gamepad_add_callback()\n");
+    {
+        assert(nk_gamepad_add_callback(&gamepads, -1, NK_GAMEPAD_BUTTON_START, &test_callback, &start) == 0);
+        assert(nk_gamepad_add_callback(&gamepads, 1, NK_GAMEPAD_BUTTON_INVALID, &test_callback, &any) == 1);
+
+        // Invalid arguments.
+        assert(nk_gamepad_add_callback(NULL, 0, NK_GAMEPAD_BUTTON_A, &test_callback, NULL) == -1);
+        assert(nk_gamepad_add_callback(&gamepads, 0, NK_GAMEPAD_BUTTON_A, NULL, NULL) == -1);
+        assert(nk_gamepad_add_callback(&gamepads, NK_GAMEPAD_MAX, NK_GAMEPAD_BUTTON_A, &test_callback, NULL) == -1);
+        assert(nk_gamepad_add_callback(&gamepads, 0, NK_GAMEPAD_BUTTON_LAST, &test_callback, NULL) == -1);
+    }
+
+    printf("nk_gamepad_update()\n");
+    {
+        // Nothing changed, nothing is called.
+        nk_gamepad_update(&gamepads);
+        assert(start.count == 0);
+        assert(any.count == 0);
+
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_START);
+        nk_gamepad_update(&gamepads);
+        assert(start.count == 1);
+        assert(start.num == 0);
+        assert(start.button == NK_GAMEPAD_BUTTON_START);
+        assert(start.down == nk_true);
+        assert(any.count == 0);
+
+        // Held buttons aren't called back again.
+        nk_gamepad_update(&gamepads);
+        assert(start.count == 1);
+
+        test_buttons[0] = 0;
+        test_buttons[1] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_B);
+        nk_gamepad_update(&gamepads);
+        assert(start.count == 2);
+        assert(start.down == nk_false);
+        assert(any.count == 2);
+        assert(any.num == 1);
+        assert(any.button == NK_GAMEPAD_BUTTON_B);
+        assert(any.down == nk_true);
+
+        // Unplugging a gamepad with buttons held releases them, once.
+        test_unplugged[1] = nk_true;
+        for (int i = 0; i < 5; i++) {
+            nk_gamepad_update(&gamepads);
+        }
+        assert(any.count == 4);
+        assert(any.down == nk_false);
+
+        // Plugging it back in with them held presses them again.
+        test_unplugged[1] = nk_false;
+        nk_gamepad_update(&gamepads);
+        assert(any.count == 6);
+        assert(any.down == nk_true);
+    }
+
+    printf("nk_gamepad_remove_callback()\n");
+    {
+        nk_gamepad_remove_callback(&gamepads, 1);
+        test_buttons[1] = 0;
+        nk_gamepad_update(&gamepads);
+        assert(any.count == 6);
+
+        // The freed slot is used again.
+        test_once_handle = nk_gamepad_add_callback(&gamepads, 1, NK_GAMEPAD_BUTTON_INVALID, &test_once, &once);
+        assert(test_once_handle == 1);
+
+        // A callback can remove itself, and isn't called for the rest of the buttons.
+        test_buttons[1] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_X) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_Y);
+        nk_gamepad_update(&gamepads);
+        assert(once.count == 1);
+        assert(once.button == NK_GAMEPAD_BUTTON_X);
+        test_buttons[1] = 0;
+        nk_gamepad_update(&gamepads);
+        assert(once.count == 1);
+
+        // Invalid handles are ignored.
+        nk_gamepad_remove_callback(&gamepads, -1);
+        nk_gamepad_remove_callback(&gamepads, NK_GAMEPAD_CALLBACKS_MAX);
+        nk_gamepad_remove_callback(NULL, 0);
+    }
+
+    printf("NK_GAMEPAD_CALLBACKS_MAX\n");
+    {
+        for (int i = 1; i < NK_GAMEPAD_CALLBACKS_MAX; i++) {
+            assert(nk_gamepad_add_callback(&gamepads, 0, NK_GAMEPAD_BUTTON_A, &test_callback, &any) == i);
+        }
+        assert(nk_gamepad_add_callback(&gamepads, 0, NK_GAMEPAD_BUTTON_A, &test_callback, &any) == -1);
+    }
+
+    nk_gamepad_free(&gamepads);
+
+    printf("------------------------------\n");
+    printf("nuklear_gamepad_callbacks_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_DB_PLATFORM "Linux"
+#include "../nuklear_gamepad.h"
+#include "../nuklear_gamepad_db.h"
+
+#define FLAG(button) ((unsigned int)NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_##button))
+
+static const char test_db[] =
+    "# Game Controller DB\r\n"
+    "\r\n"
+    "030000005e0400008e02000000007801,XInput Controller,a:b0,b:b1,back:b6,dpdown:h0.4,dpleft:h0.8,dpright:h0.2,dpup:h0.1,guide:b8,leftshoulder:b4,rightshoulder:b5,start:b7,x:b2,y:b3,platform:Windows,\r\n"
+    "030000004c050000c405000000010000,PS4 Controller,a:b1,b:b2,back:b8,dpdown:+a7,dpleft:-a6,dpright:+a6,dpup:-a7,guide:b12,leftshoulder:b4,rightshoulder:b5,start:b9,x:b0,y:b3,platform:Mac OS X,\r\n"
+    "030000004c050000c405000000010000,PS4 Controller,a:b0,b:b1,back:b8,dpdown:h0.4,dpleft:h0.8,dpright:h0.2,dpup:h0.1,guide:b10,leftshoulder:b4,rightshoulder:b5,start:b9,x:b3,y:b2,platform:Linux,\r\n"
+    "03000000de2800000112000001000000,Steam Controller With A Really Long Name,a:b0,b:b1,back:b6,start:b7,x:b2,y:b3,leftshoulder:a2~,rightshoulder:a5,platform:Linux,\r\n"
+    "not a mapping line\r\n"
+    "030000004c050000c405000000010000,PS4 Controller Override,a:b1,b:b2,x:b0,y:b3,platform:Linux";
+
+int main() {
+    printf("nuklear_gamepad_db_test\n");
+    printf("-----------------------\n");
+
+    printf("nk_gamepad_db_guid()\n");
+    char guid[33];
+    {
+        nk_gamepad_db_guid(guid, 0x0003, 0x054C, 0x05C4, 0x0100);
+        assert(strcmp(guid, "030000004c050000c405000000010000") == 0);
+    }
+
+    printf("nk_gamepad_db_load_memory()\n");
+    struct nk_gamepad_db db;
+    {
+        assert(nk_gamepad_db_load_memory(&db, test_db, sizeof(test_db) - 1) == nk_true);
+        assert(db.count == 5);
+        assert(db.capacity >= db.count * 2);
+    }
+
+    printf("nk_gamepad_db_find()\n");
+    {
+        struct nk_gamepad_db_mapping mapping;
+
+        // The last Linux entry wins, and GUIDs are matched regardless of case.
+        assert(nk_gamepad_db_find(&db, "030000004C050000C405000000010000", &mapping) == nk_true);
+        assert(strcmp(mapping.guid, "030000004c050000c405000000010000") == 0);
+        assert(strncmp(mapping.name, "PS4 Controller Override", NK_GAMEPAD_NAME_SIZE - 1) == 0);
+        assert(mapping.buttons[NK_GAMEPAD_BUTTON_A].type == NK_GAMEPAD_DB_BINDING_BUTTON);
+        assert(mapping.buttons[NK_GAMEPAD_BUTTON_A].index == 1);
+        assert(mapping.buttons[NK_GAMEPAD_BUTTON_UP].type == NK_GAMEPAD_DB_BINDING_NONE);
+
+        // Entries for other platforms are skipped.
+        assert(nk_gamepad_db_find(&db, "030000005e0400008e02000000007801", &mapping) == nk_false);
+        assert(nk_gamepad_db_find(&db, "00000000000000000000000000000000", &mapping) == nk_false);
+        assert(nk_gamepad_db_find(&db, "not a guid", &mapping) == nk_false);
+
+        // Axis bindings.
+        assert(nk_gamepad_db_find(&db, "03000000de2800000112000001000000", &mapping) == nk_true);
+        assert(strlen(mapping.name) == NK_GAMEPAD_NAME_SIZE - 1);
+        assert(mapping.buttons[NK_GAMEPAD_BUTTON_LB].type == NK_GAMEPAD_DB_BINDING_AXIS);
+        assert(mapping.buttons[NK_GAMEPAD_BUTTON_LB].index == 2);
+        assert(mapping.buttons[NK_GAMEPAD_BUTTON_LB].axis_inverted == nk_true);
+        assert(mapping.buttons[NK_GAMEPAD_BUTTON_RB].axis_direction == 0);
+    }
+
+    printf("nk_gamepad_db_buttons()\n");
+    {
+        // Leave out the override at the end of the database.
+        struct nk_gamepad_db_mapping mapping;
+        nk_gamepad_db_free(&db);
+        assert(nk_gamepad_db_load_memory(&db, test_db, (size_t)(strstr(test_db, "not a mapping") - test_db)) == nk_true);
+        assert(db.count == 4);
+        assert(nk_gamepad_db_find(&db, guid, &mapping) == nk_true);
+        assert(strcmp(mapping.name, "PS4 Controller") == 0);
+        assert(mapping.buttons[NK_GAMEPAD_BUTTON_LEFT].type == NK_GAMEPAD_DB_BINDING_HAT);
+        assert(mapping.buttons[NK_GAMEPAD_BUTTON_LEFT].hat_mask == 8);
+
+        unsigned char buttons[13] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0 };
+        unsigned char hats[1] = { 1 | 8 };
+        assert(nk_gamepad_db_buttons(&mapping, buttons, 13, NULL, 0, hats, 1) ==
+            (FLAG(A) | FLAG(RB) | FLAG(GUIDE) | FLAG(UP) | FLAG(LEFT)));
+
+        // Out of range indices are ignored.
+        assert(nk_gamepad_db_buttons(&mapping, buttons, 1, NULL, 0, NULL, 0) == FLAG(A));
+
+        struct nk_gamepad_db_mapping steam;
+        assert(nk_gamepad_db_find(&db, "03000000de2800000112000001000000", &steam) == nk_true);
+        float axes[6] = { 0.0f, 0.0f, -1.0f, 0.0f, 0.0f, 1.0f };
+        assert(nk_gamepad_db_buttons(&steam, NULL, 0, axes, 6, NULL, 0) == (FLAG(LB) | FLAG(RB)));
+        axes[2] = 1.0f;
+        axes[5] = -1.0f;
+        assert(nk_gamepad_db_buttons(&steam, NULL, 0, axes, 6, NULL, 0) == 0);
+    }
+
+    printf("nk_gamepad_db_load_file()\n");
+    {
+        const char* path = "nuklear_gamepad_db_test.txt";
+        FILE* file = fopen(path, "wb");
+        assert(file != NULL);
+        fwrite(test_db, 1, sizeof(test_db) - 1, file);
+        fclose(file);
+
+        struct nk_gamepad_db file_db;
+        struct nk_gamepad_db_mapping mapping;
+        assert(nk_gamepad_db_load_file(&file_db, path) == nk_true);
+        assert(file_db.count == 5);
+        assert(nk_gamepad_db_find(&file_db, guid, &mapping) == nk_true);
+        assert(mapping.buttons[NK_GAMEPAD_BUTTON_B].index == 2);
+        nk_gamepad_db_free(&file_db);
+        remove(path);
+
+        assert(nk_gamepad_db_load_file(&file_db, path) == nk_false);
+    }
+
+    printf("nk_gamepad_db_free()\n");
+    nk_gamepad_db_free(&db);
+    assert(db.entries == NULL);
+
+    printf("-----------------------\n");
+    printf("nuklear_gamepad_db_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_TRACE
+#include "../nuklear_gamepad.h"
+#include "../nuklear_gamepad_debug.h"
+
+static int test_updates = 0;
+
+static void test_update(struct nk_gamepads* gamepads, void* user_data) {
+    NK_UNUSED(user_data);
+    gamepads->gamepads[1].available = nk_true;
+    gamepads->gamepads[1].buttons = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+    test_updates++;
+}
+
+static float test_font_width(nk_handle handle, float height, const char* text, int len) {
+    NK_UNUSED(handle);
+    NK_UNUSED(text);
+    return height * 0.5f * (float)len;
+}
+
+int main() {
+    printf("nuklear_gamepad_debug_test\n");
+    printf("--------------------------\n");
+
+    printf("nk_gamepad_now()\n");
+    {
+        nk_gamepad_time start = nk_gamepad_now();
+        assert(nk_gamepad_now() >= start);
+    }
+
+    struct nk_gamepads gamepads;
+    struct nk_gamepad_debug debug;
+    struct nk_gamepad_input_source source = {
+        .update = &test_update,
+    };
+
+    printf("nk_gamepad_debug_input_source()\n");
+    {
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_debug_input_source(&debug, source)) == nk_true);
+        for (int i = 0; i < 10; i++) {
+            nk_gamepad_update(&gamepads);
+        }
+
+        // The wrapped source still runs, and every update lands in the histogram.
+        assert(test_updates == 10);
+        assert(nk_gamepad_is_button_down(&gamepads, 1, NK_GAMEPAD_BUTTON_A) == nk_true);
+        assert(debug.polls == 10);
+        assert(debug.max >= debug.last);
+        assert(debug.total >= debug.max);
+        unsigned int measured = 0;
+        for (int i = 0; i < NK_GAMEPAD_DEBUG_BUCKETS; i++) {
+            measured += debug.histogram[i];
+        }
+        assert(measured == 10);
+        assert(strcmp(nk_gamepad_name(&gamepads, 1), "Controller 2") == 0);
+    }
+
+    printf("nk_gamepad_debug_overlay()\n");
+    {
+        struct nk_user_font font;
+        font.userdata = nk_handle_ptr(NULL);
+        font.height = 13;
+        font.width = &test_font_width;
+
+        struct nk_context ctx;
+        assert(nk_init_default(&ctx, &font) == nk_true);
+        nk_gamepad_debug_overlay(NULL, &gamepads);
+        nk_gamepad_debug_overlay(&ctx, NULL);
+        for (int frame = 0; frame < 3; frame++) {
+            nk_input_begin(&ctx);
+            nk_input_end(&ctx);
+            nk_gamepad_update(&gamepads);
+            nk_gamepad_debug_overlay(&ctx, &gamepads);
+            nk_clear(&ctx);
+        }
+        nk_free(&ctx);
+    }
+
+    nk_gamepad_free(&gamepads);
+
+    printf("--------------------------\n");
+    printf("nuklear_gamepad_debug_test: Tests passed!\n");
+
+    return 0;
+}
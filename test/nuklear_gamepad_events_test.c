@@ -0,0 +1,198 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <assert.h>
+#include <stdio.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_EVENTS
+#define NK_GAMEPAD_EVENTS_SIZE 4
+#include "../nuklear_gamepad.h"
+#include "nuklear_gamepad_test_source.h"
+
+int main() {
+    printf("nuklear_gamepad_events_test\n");
+    printf("---------------------------\n");
+
+    struct nk_gamepads gamepads;
+    assert(test_source_init(&gamepads, NULL) == nk_true);
+
+    printf("nk_gamepad_event_next()\n");
+    {
+        unsigned int cursor = 0;
+        struct nk_gamepad_event event;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_event_next(&gamepads, &cursor, &event) == nk_false);
+
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_event_next(&gamepads, &cursor, &event) == nk_true);
+        assert(event.num == 0);
+        assert(event.buttons == (unsigned int)NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A));
+        assert(event.changed == (unsigned int)NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A));
+        assert(event.time != 0);
+        assert(nk_gamepad_event_next(&gamepads, &cursor, &event) == nk_false);
+
+        // Holding the button changes nothing.
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_event_next(&gamepads, &cursor, &event) == nk_false);
+
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_event_next(&gamepads, &cursor, &event) == nk_true);
+        assert(event.buttons == 0);
+        assert(event.changed == (unsigned int)NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A));
+
+        // Events that were overwritten before being read are skipped.
+        for (int i = 0; i < 6; i++) {
+            test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(i);
+            nk_gamepad_update(&gamepads);
+        }
+        int count = 0;
+        while (nk_gamepad_event_next(&gamepads, &cursor, &event)) {
+            count++;
+        }
+        assert(count == NK_GAMEPAD_EVENTS_SIZE);
+        assert(event.buttons == (unsigned int)NK_GAMEPAD_BUTTON_FLAG(5));
+
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+    }
+
+    printf("nk_gamepad_tick()\n");
+    {
+        struct nk_gamepad_ticker ticker;
+        const nk_gamepad_time hour = 3600000000000ULL;
+        nk_gamepad_ticker_init(&ticker, &gamepads, hour);
+        nk_gamepad_time start = ticker.time;
+
+        // Ticks only happen once a whole step has passed.
+        assert(nk_gamepad_tick(&ticker, start + hour - 1) == nk_false);
+        assert(nk_gamepad_tick(&ticker, start + hour) == nk_true);
+        assert(ticker.time == start + hour);
+        assert(nk_gamepad_tick(&ticker, start + hour) == nk_false);
+
+        // A press and release within a single tick are both seen.
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_B);
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_tick(&ticker, ticker.time + hour) == nk_true);
+        assert(nk_gamepad_tick_is_button_pressed(&ticker, 0, NK_GAMEPAD_BUTTON_B) == nk_true);
+        assert(nk_gamepad_tick_is_button_released(&ticker, -1, NK_GAMEPAD_BUTTON_B) == nk_true);
+        assert(nk_gamepad_tick_is_button_down(&ticker, 0, NK_GAMEPAD_BUTTON_B) == nk_false);
+    }
+
+    printf("nk_gamepad_tick_is_button_pressed()\n");
+    {
+        struct nk_gamepad_ticker ticker;
+        nk_gamepad_ticker_init(&ticker, &gamepads, 1000);
+
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_X);
+        nk_gamepad_update(&gamepads);
+        unsigned int cursor = ticker.cursor;
+        struct nk_gamepad_event event;
+        assert(nk_gamepad_event_next(&gamepads, &cursor, &event) == nk_true);
+
+        // Ticks that end before the press don't see it, however many of them there are.
+        while (nk_gamepad_tick(&ticker, event.time - 1)) {
+            assert(nk_gamepad_tick_is_button_pressed(&ticker, 0, NK_GAMEPAD_BUTTON_X) == nk_false);
+            assert(nk_gamepad_tick_is_button_down(&ticker, 0, NK_GAMEPAD_BUTTON_X) == nk_false);
+        }
+
+        // The tick it happened in sees it once, and the following ones see it held.
+        assert(nk_gamepad_tick(&ticker, ticker.time + ticker.step) == nk_true);
+        assert(ticker.time >= event.time);
+        assert(nk_gamepad_tick_is_button_pressed(&ticker, 0, NK_GAMEPAD_BUTTON_X) == nk_true);
+        assert(nk_gamepad_tick_is_button_pressed(&ticker, -1, NK_GAMEPAD_BUTTON_X) == nk_true);
+        assert(nk_gamepad_tick(&ticker, ticker.time + ticker.step) == nk_true);
+        assert(nk_gamepad_tick_is_button_pressed(&ticker, 0, NK_GAMEPAD_BUTTON_X) == nk_false);
+        assert(nk_gamepad_tick_is_button_down(&ticker, 0, NK_GAMEPAD_BUTTON_X) == nk_true);
+
+        // Invalid arguments.
+        assert(nk_gamepad_tick_is_button_down(NULL, 0, NK_GAMEPAD_BUTTON_X) == nk_false);
+        assert(nk_gamepad_tick_is_button_down(&ticker, NK_GAMEPAD_MAX, NK_GAMEPAD_BUTTON_X) == nk_false);
+        assert(nk_gamepad_tick_is_button_down(&ticker, 0, NK_GAMEPAD_BUTTON_LAST) == nk_false);
+        assert(nk_gamepad_tick(NULL, event.time) == nk_false);
+        nk_gamepad_ticker_init(&ticker, &gamepads, 0);
+        assert(nk_gamepad_tick(&ticker, ticker.time) == nk_false);
+    }
+
+    printf("nk_gamepad_event_next() with a gamepad unplugged\n");
+    {
+        struct nk_gamepad_ticker ticker;
+        nk_gamepad_ticker_init(&ticker, &gamepads, 1000);
+        unsigned int cursor = ticker.cursor;
+        struct nk_gamepad_event event;
+        test_buttons[1] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_event_next(&gamepads, &cursor, &event) == nk_true);
+
+        // Unplugging it with the button held releases it, once.
+        test_unplugged[1] = nk_true;
+        for (int i = 0; i < 5; i++) {
+            nk_gamepad_update(&gamepads);
+        }
+        assert(nk_gamepad_event_next(&gamepads, &cursor, &event) == nk_true);
+        assert(event.num == 1);
+        assert(event.buttons == 0);
+        assert(event.changed == (unsigned int)NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A));
+        assert(nk_gamepad_event_next(&gamepads, &cursor, &event) == nk_false);
+        assert(nk_gamepad_tick(&ticker, ticker.time + ticker.step) == nk_true);
+        assert(nk_gamepad_tick_is_button_released(&ticker, 1, NK_GAMEPAD_BUTTON_A) == nk_true);
+        assert(nk_gamepad_tick_is_button_down(&ticker, 1, NK_GAMEPAD_BUTTON_A) == nk_false);
+
+        // Plugging it back in with nothing held changes nothing.
+        test_unplugged[1] = nk_false;
+        test_buttons[1] = 0;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_event_next(&gamepads, &cursor, &event) == nk_false);
+    }
+
+    printf("nk_gamepad_consumer_update()\n");
+    {
+        struct nk_gamepad_consumer consumer;
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_consumer_init(&consumer, &gamepads);
+
+        // A tap between two consumer updates is still seen.
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_Y);
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_consumer_update(&consumer);
+        assert(nk_gamepad_consumer_is_button_pressed(&consumer, 0, NK_GAMEPAD_BUTTON_Y) == nk_true);
+        assert(nk_gamepad_consumer_is_button_released(&consumer, 0, NK_GAMEPAD_BUTTON_Y) == nk_true);
+        assert(nk_gamepad_consumer_is_button_down(&consumer, 0, NK_GAMEPAD_BUTTON_Y) == nk_false);
+
+        nk_gamepad_consumer_update(&consumer);
+        assert(nk_gamepad_consumer_is_button_pressed(&consumer, 0, NK_GAMEPAD_BUTTON_Y) == nk_false);
+
+        // Presses are still seen when the ring was overrun.
+        for (int i = 0; i < NK_GAMEPAD_EVENTS_SIZE * 2; i++) {
+            test_buttons[0] = (i & 1) ? 0 : NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+            nk_gamepad_update(&gamepads);
+        }
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_B);
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_consumer_update(&consumer);
+        assert(nk_gamepad_consumer_is_button_pressed(&consumer, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+        assert(nk_gamepad_consumer_is_button_pressed(&consumer, 0, NK_GAMEPAD_BUTTON_B) == nk_true);
+        assert(nk_gamepad_consumer_is_button_down(&consumer, 0, NK_GAMEPAD_BUTTON_B) == nk_true);
+    }
+
+    nk_gamepad_free(&gamepads);
+
+    printf("---------------------------\n");
+    printf("nuklear_gamepad_events_test: Tests passed!\n");
+
+    return 0;
+}
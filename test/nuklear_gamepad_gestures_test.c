@@ -0,0 +1,155 @@
+#include <assert.h>
+#include <stdio.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_GESTURES
+#define NK_GAMEPAD_GESTURES_DOUBLE_TAP 300
+#define NK_GAMEPAD_GESTURES_LONG_PRESS 500
+#define NK_GAMEPAD_GESTURES_REPEAT_DELAY 400
+#define NK_GAMEPAD_GESTURES_REPEAT_INTERVAL 100
+#include "../nuklear_gamepad.h"
+#include "nuklear_gamepad_test_source.h"
+
+int main() {
+    printf("nuklear_gamepad_gestures_test\n");
+    printf("-----------------------------\n");
+
+    struct nk_gamepads gamepads;
+    assert(test_source_init(&gamepads, NULL) == nk_true);
+
+    const unsigned int a = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+
+    printf("nk_gamepad_is_button_double_tapped()\n");
+    {
+        // A clock starting at 0 is fine.
+        test_time = 0;
+        test_buttons[0] = a;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_double_tapped(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+        test_buttons[0] = 0;
+        test_time += 100;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = a;
+        test_time += 200;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_double_tapped(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+        assert(nk_gamepad_is_button_double_tapped(&gamepads, -1, NK_GAMEPAD_BUTTON_A) == nk_true);
+        assert(nk_gamepad_is_button_double_tapped(&gamepads, 0, NK_GAMEPAD_BUTTON_B) == nk_false);
+
+        // Only for the update it happened in.
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_double_tapped(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+
+        // A third press starts over.
+        test_buttons[0] = 0;
+        test_time += 10;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = a;
+        test_time += 10;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_double_tapped(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+
+        // Too slow.
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        test_time += 1000;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = a;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = 0;
+        test_time += 301;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = a;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_double_tapped(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+        test_buttons[0] = 0;
+        test_time += 1000;
+        nk_gamepad_update(&gamepads);
+
+        assert(nk_gamepad_is_button_double_tapped(NULL, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+        assert(nk_gamepad_is_button_double_tapped(&gamepads, NK_GAMEPAD_MAX, NK_GAMEPAD_BUTTON_A) == nk_false);
+        assert(nk_gamepad_is_button_double_tapped(&gamepads, 0, NK_GAMEPAD_BUTTON_LAST) == nk_false);
+    }
+
+    printf("nk_gamepad_is_button_long_pressed()\n");
+    {
+        test_time += 1000;
+        test_buttons[0] = a;
+        nk_gamepad_update(&gamepads);
+        test_time += 499;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_long_pressed(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+        test_time += 1;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_long_pressed(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+
+        // Reported once per hold.
+        test_time += 1000;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_long_pressed(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+
+        // Letting go before the threshold isn't a long press.
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = a;
+        test_time += 1000;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = 0;
+        test_time += 400;
+        nk_gamepad_update(&gamepads);
+        test_time += 1000;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_long_pressed(&gamepads, -1, NK_GAMEPAD_BUTTON_A) == nk_false);
+    }
+
+    printf("nk_gamepad_is_button_repeated()\n");
+    {
+        test_time += 1000;
+        test_buttons[0] = a;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_repeated(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+
+        // Nothing until the delay.
+        test_time += 399;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_repeated(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+        test_time += 1;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_repeated(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+
+        // Then every interval.
+        test_time += 50;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_repeated(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+        test_time += 50;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_repeated(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+
+        // A slow update repeats once, rather than catching up.
+        test_time += 1000;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_repeated(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+        test_time += 50;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_repeated(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+
+        // Stops once released.
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        test_time += 1000;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_repeated(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+    }
+
+    nk_gamepad_free(&gamepads);
+
+    printf("-----------------------------\n");
+    printf("nuklear_gamepad_gestures_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_HIDRAW
+#include "../nuklear_gamepad.h"
+
+#define FLAG(button) ((unsigned int)NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_##button))
+
+/**
+ * Input reports recorded from real controllers, trimmed to the bytes that matter.
+ */
+
+// Xbox Series X over Bluetooth: sticks centered, d-pad down-left, A + RB + Menu.
+static const unsigned char xbox_bt_report[17] = {
+    0x01, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x81, 0x08, 0x00
+};
+
+// Xbox One S over Bluetooth, older firmware: Xbox button report.
+static const unsigned char xbox_bt_guide_report[2] = { 0x02, 0x01 };
+
+// DualShock 4 over USB: d-pad up, Cross + L1 + Options + PS.
+static const unsigned char ds4_usb_report[64] = {
+    0x01, 0x80, 0x7F, 0x81, 0x80, 0x20, 0x21, 0x01, 0x00, 0x00
+};
+
+// DualShock 4 over Bluetooth: d-pad centered, Triangle + Share.
+static const unsigned char ds4_bt_report[78] = {
+    0x11, 0xC0, 0x00, 0x80, 0x80, 0x80, 0x80, 0x88, 0x10, 0x00
+};
+
+// DualSense over USB: d-pad right, Square + Circle + R1.
+static const unsigned char dualsense_usb_report[64] = {
+    0x01, 0x7F, 0x80, 0x80, 0x7E, 0x00, 0x00, 0x2A, 0x52, 0x02, 0x00
+};
+
+// DualSense over Bluetooth: d-pad centered, PS.
+static const unsigned char dualsense_bt_report[78] = {
+    0x31, 0x10, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x3C, 0x08, 0x00, 0x01
+};
+
+// Switch Pro Controller full report: B + Y + ZR (ignored) + Plus + d-pad left + L.
+static const unsigned char switch_pro_full_report[49] = {
+    0x30, 0x5A, 0x91, 0x85, 0x02, 0x48, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80
+};
+
+// Switch Pro Controller simple Bluetooth report: A + R + Home, d-pad up.
+static const unsigned char switch_pro_simple_report[12] = {
+    0x3F, 0x22, 0x10, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80
+};
+
+int main() {
+    printf("nuklear_gamepad_hidraw_test\n");
+    printf("---------------------------\n");
+
+    printf("nk_gamepad_hidraw_find_model()\n");
+    {
+        const struct nk_gamepad_hidraw_model* model = nk_gamepad_hidraw_find_model(0x054C, 0x0CE6);
+        assert(model != NULL);
+        assert(model->decode == &nk_gamepad_hidraw_decode_dualsense);
+        assert(strcmp(model->name, "PS5 Controller") == 0);
+        assert(nk_gamepad_hidraw_find_model(0x1234, 0x5678) == NULL);
+    }
+
+    printf("nk_gamepad_hidraw_decode_xbox()\n");
+    {
+        unsigned int buttons = 0;
+        assert(nk_gamepad_hidraw_decode_xbox(xbox_bt_report, sizeof(xbox_bt_report), &buttons) == nk_true);
+        assert(buttons == (FLAG(DOWN) | FLAG(LEFT) | FLAG(A) | FLAG(RB) | FLAG(START)));
+
+        // The guide report only touches the guide button.
+        assert(nk_gamepad_hidraw_decode_xbox(xbox_bt_guide_report, sizeof(xbox_bt_guide_report), &buttons) == nk_true);
+        assert(buttons == (FLAG(DOWN) | FLAG(LEFT) | FLAG(A) | FLAG(RB) | FLAG(START) | FLAG(GUIDE)));
+
+        // Truncated reports are ignored.
+        assert(nk_gamepad_hidraw_decode_xbox(xbox_bt_report, 8, &buttons) == nk_false);
+    }
+
+    printf("nk_gamepad_hidraw_decode_ds4()\n");
+    {
+        unsigned int buttons = 0;
+        assert(nk_gamepad_hidraw_decode_ds4(ds4_usb_report, sizeof(ds4_usb_report), &buttons) == nk_true);
+        assert(buttons == (FLAG(UP) | FLAG(A) | FLAG(LB) | FLAG(START) | FLAG(GUIDE)));
+
+        assert(nk_gamepad_hidraw_decode_ds4(ds4_bt_report, sizeof(ds4_bt_report), &buttons) == nk_true);
+        assert(buttons == (FLAG(Y) | FLAG(BACK)));
+
+        // Feature and output reports are not input.
+        unsigned char feature[2] = { 0x05, 0xFF };
+        assert(nk_gamepad_hidraw_decode_ds4(feature, sizeof(feature), &buttons) == nk_false);
+        assert(buttons == (FLAG(Y) | FLAG(BACK)));
+    }
+
+    printf("nk_gamepad_hidraw_decode_dualsense()\n");
+    {
+        unsigned int buttons = 0;
+        assert(nk_gamepad_hidraw_decode_dualsense(dualsense_usb_report, sizeof(dualsense_usb_report), &buttons) == nk_true);
+        assert(buttons == (FLAG(RIGHT) | FLAG(X) | FLAG(B) | FLAG(RB)));
+
+        assert(nk_gamepad_hidraw_decode_dualsense(dualsense_bt_report, sizeof(dualsense_bt_report), &buttons) == nk_true);
+        assert(buttons == FLAG(GUIDE));
+
+        // The short Bluetooth report uses the DualShock 4 layout.
+        assert(nk_gamepad_hidraw_decode_dualsense(ds4_usb_report, 10, &buttons) == nk_true);
+        assert(buttons == (FLAG(UP) | FLAG(A) | FLAG(LB) | FLAG(START) | FLAG(GUIDE)));
+    }
+
+    printf("nk_gamepad_hidraw_decode_switch_pro()\n");
+    {
+        unsigned int buttons = 0;
+        assert(nk_gamepad_hidraw_decode_switch_pro(switch_pro_full_report, sizeof(switch_pro_full_report), &buttons) == nk_true);
+        assert(buttons == (FLAG(A) | FLAG(X) | FLAG(START) | FLAG(LEFT) | FLAG(LB)));
+
+        assert(nk_gamepad_hidraw_decode_switch_pro(switch_pro_simple_report, sizeof(switch_pro_simple_report), &buttons) == nk_true);
+        assert(buttons == (FLAG(B) | FLAG(RB) | FLAG(GUIDE) | FLAG(UP)));
+    }
+
+    printf("nk_gamepad_hidraw_input_source()\n");
+    {
+        // Without hardware, every slot should be unavailable and updates should be harmless.
+        struct nk_gamepad_hidraw hidraw;
+        struct nk_gamepads gamepads;
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_hidraw_input_source(&hidraw)) == nk_true);
+        for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+            if (hidraw.fd[num] < 0) {
+                assert(nk_gamepad_is_available(&gamepads, num) == nk_false);
+            }
+        }
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_free(&gamepads);
+    }
+
+    printf("---------------------------\n");
+    printf("nuklear_gamepad_hidraw_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <assert.h>
+#include <stdio.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_HISTORY
+#include "../nuklear_gamepad.h"
+#include "nuklear_gamepad_test_source.h"
+
+/**
+ * Run a number of updates with the given buttons held.
+ */
+static void test_hold(struct nk_gamepads* gamepads, unsigned int buttons, int updates) {
+    test_buttons[0] = buttons;
+    for (int i = 0; i < updates; i++) {
+        nk_gamepad_update(gamepads);
+    }
+}
+
+int main() {
+    printf("nuklear_gamepad_history_test\n");
+    printf("----------------------------\n");
+
+    struct nk_gamepads gamepads;
+    assert(test_source_init(&gamepads, NULL) == nk_true);
+    const unsigned int b = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_B);
+
+    printf("nk_gamepad_is_button_pressed_within()\n");
+    {
+        test_hold(&gamepads, 0, 4);
+        assert(nk_gamepad_is_button_pressed_within(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 8) == nk_false);
+
+        // Pressed, held for two updates, then released for five.
+        test_hold(&gamepads, b, 2);
+        assert(nk_gamepad_is_button_pressed_within(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 1) == nk_false);
+        assert(nk_gamepad_is_button_pressed_within(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 2) == nk_true);
+        test_hold(&gamepads, 0, 5);
+        assert(nk_gamepad_is_button_pressed_within(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 6) == nk_false);
+        assert(nk_gamepad_is_button_pressed_within(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 7) == nk_true);
+        assert(nk_gamepad_is_button_pressed_within(&gamepads, -1, NK_GAMEPAD_BUTTON_B, 7) == nk_true);
+        assert(nk_gamepad_is_button_pressed_within(&gamepads, 1, NK_GAMEPAD_BUTTON_B, 7) == nk_false);
+
+        // A window of 1 is the same as nk_gamepad_is_button_pressed().
+        test_hold(&gamepads, b, 1);
+        assert(nk_gamepad_is_button_pressed_within(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 1) == nk_true);
+        assert(nk_gamepad_is_button_pressed(&gamepads, 0, NK_GAMEPAD_BUTTON_B) == nk_true);
+
+        // Invalid arguments.
+        assert(nk_gamepad_is_button_pressed_within(NULL, 0, NK_GAMEPAD_BUTTON_B, 1) == nk_false);
+        assert(nk_gamepad_is_button_pressed_within(&gamepads, NK_GAMEPAD_MAX, NK_GAMEPAD_BUTTON_B, 1) == nk_false);
+        assert(nk_gamepad_is_button_pressed_within(&gamepads, 0, NK_GAMEPAD_BUTTON_LAST, 1) == nk_false);
+        assert(nk_gamepad_is_button_pressed_within(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 0) == nk_false);
+        assert(nk_gamepad_is_button_pressed_within(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 64) == nk_false);
+    }
+
+    printf("nk_gamepad_is_button_held_for()\n");
+    {
+        test_hold(&gamepads, b, 9);
+        assert(nk_gamepad_is_button_held_for(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 10) == nk_true);
+        assert(nk_gamepad_is_button_held_for(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 11) == nk_false);
+        assert(nk_gamepad_is_button_held_for(&gamepads, -1, NK_GAMEPAD_BUTTON_B, 10) == nk_true);
+        assert(nk_gamepad_is_button_held_for(&gamepads, 0, NK_GAMEPAD_BUTTON_A, 1) == nk_false);
+
+        test_hold(&gamepads, b, 64);
+        assert(nk_gamepad_is_button_held_for(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 64) == nk_true);
+        test_hold(&gamepads, 0, 1);
+        assert(nk_gamepad_is_button_held_for(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 1) == nk_false);
+    }
+
+    printf("nk_gamepad_button_taps()\n");
+    {
+        test_hold(&gamepads, 0, 63);
+        assert(nk_gamepad_button_taps(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 63) == 0);
+
+        // Three taps, two updates apart.
+        for (int i = 0; i < 3; i++) {
+            test_hold(&gamepads, b, 1);
+            test_hold(&gamepads, 0, 1);
+        }
+        assert(nk_gamepad_button_taps(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 6) == 3);
+        assert(nk_gamepad_button_taps(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 4) == 2);
+        assert(nk_gamepad_button_taps(&gamepads, 0, NK_GAMEPAD_BUTTON_B, 1) == 0);
+        assert(nk_gamepad_button_taps(&gamepads, 1, NK_GAMEPAD_BUTTON_B, 6) == 0);
+        assert(nk_gamepad_button_taps(&gamepads, -1, NK_GAMEPAD_BUTTON_B, 6) == 0);
+    }
+
+    nk_gamepad_free(&gamepads);
+
+    printf("----------------------------\n");
+    printf("nuklear_gamepad_history_test: Tests passed!\n");
+
+    return 0;
+}
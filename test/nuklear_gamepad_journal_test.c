@@ -0,0 +1,178 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define TEST_THREADS 4
+#define TEST_THREAD_WRITES 10000
+#include <pthread.h>
+#endif
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#include "stubs/nuklear_gamepad_stubs.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_JOURNAL
+#define NK_GAMEPAD_JOURNAL_SIZE 16
+#include "../nuklear_gamepad.h"
+#include "../nuklear_gamepad_sdl.h"
+
+/**
+ * Read everything new in the journal, and return how many events of the given type were read.
+ */
+static int test_count(struct nk_gamepads* gamepads, unsigned int* cursor, enum nk_gamepad_journal_type type) {
+    struct nk_gamepad_journal_entry entry;
+    int count = 0;
+    while (nk_gamepad_journal_next(gamepads, cursor, &entry)) {
+        if (entry.type == type) {
+            count++;
+        }
+    }
+    return count;
+}
+
+static const char* test_name = "First";
+
+static const char* test_source_name(struct nk_gamepads* gamepads, int num, void* user_data) {
+    NK_UNUSED(gamepads);
+    NK_UNUSED(num);
+    NK_UNUSED(user_data);
+    return test_name;
+}
+
+static nk_bool test_source_init(struct nk_gamepads* gamepads, void* user_data) {
+    NK_UNUSED(user_data);
+    gamepads->gamepads[0].available = nk_true;
+    return nk_true;
+}
+
+static struct nk_gamepad_input_source test_empty_source = {NULL, NULL, NULL, NULL, NULL, nk_false};
+
+#ifdef TEST_THREADS
+static struct nk_gamepads test_threads_gamepads;
+
+static void* test_writer(void* data) {
+    int id = *(int*)data;
+    for (int i = 0; i < TEST_THREAD_WRITES; i++) {
+        nk_gamepad_journal_write(&test_threads_gamepads, id, "test", NK_GAMEPAD_JOURNAL_CONNECTED, id);
+    }
+    return NULL;
+}
+#endif
+
+int main() {
+    printf("nuklear_gamepad_journal_test\n");
+    printf("----------------------------\n");
+
+    printf("nk_gamepad_sdl_handle_event()\n");
+    {
+        struct nk_gamepads gamepads;
+        unsigned int cursor = 0;
+        nk_gamepad_stub_reset();
+        nk_gamepad_stub_devices[0].connected = true;
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_sdl_input_soure(NULL)) == nk_true);
+
+        struct nk_gamepad_journal_entry entry;
+        assert(nk_gamepad_journal_next(&gamepads, &cursor, &entry) == nk_true);
+        assert(entry.type == NK_GAMEPAD_JOURNAL_CONNECTED);
+        assert(entry.num == 0);
+        assert(strcmp(entry.backend, "sdl") == 0);
+        assert(strcmp(nk_gamepad_journal_type_name(entry.type), "connected") == 0);
+        assert(nk_gamepad_journal_next(&gamepads, &cursor, &entry) == nk_false);
+
+        SDL_Event event;
+        event.cdevice.type = SDL_CONTROLLERDEVICEREMOVED;
+        event.cdevice.which = 0;
+        nk_gamepad_sdl_handle_event(&gamepads, &event);
+        assert(test_count(&gamepads, &cursor, NK_GAMEPAD_JOURNAL_DISCONNECTED) == 1);
+
+        // Plugged in later.
+        event.cdevice.type = SDL_CONTROLLERDEVICEADDED;
+        event.cdevice.which = 1;
+        nk_gamepad_stub_devices[1].connected = true;
+        nk_gamepad_sdl_handle_event(&gamepads, &event);
+        assert(test_count(&gamepads, &cursor, NK_GAMEPAD_JOURNAL_CONNECTED) == 1);
+        nk_gamepad_free(&gamepads);
+    }
+
+    printf("nk_gamepad_name()\n");
+    {
+        struct nk_gamepads gamepads;
+        unsigned int cursor = 0;
+        struct nk_gamepad_input_source source = {
+            .init = &test_source_init,
+            .name = &test_source_name,
+        };
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, source) == nk_true);
+
+        // The first name isn't a change.
+        nk_gamepad_name(&gamepads, 0);
+        nk_gamepad_name(&gamepads, 0);
+        assert(test_count(&gamepads, &cursor, NK_GAMEPAD_JOURNAL_NAME_CHANGED) == 0);
+
+        test_name = "Second";
+        nk_gamepad_name(&gamepads, 0);
+        assert(test_count(&gamepads, &cursor, NK_GAMEPAD_JOURNAL_NAME_CHANGED) == 1);
+        nk_gamepad_free(&gamepads);
+    }
+
+    printf("nk_gamepad_journal_next()\n");
+    {
+        struct nk_gamepads gamepads;
+        unsigned int cursor = 0;
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, test_empty_source) == nk_true);
+        assert(nk_gamepad_journal_next(NULL, &cursor, NULL) == nk_false);
+
+        // Only the newest events are kept once the journal wraps around.
+        for (int i = 0; i < NK_GAMEPAD_JOURNAL_SIZE + 5; i++) {
+            nk_gamepad_journal_write(&gamepads, 0, "test", NK_GAMEPAD_JOURNAL_OPEN_FAILED, i);
+        }
+        struct nk_gamepad_journal_entry entry;
+        int read = 0;
+        while (nk_gamepad_journal_next(&gamepads, &cursor, &entry)) {
+            assert(entry.detail == 5 + read);
+            read++;
+        }
+        assert(read == NK_GAMEPAD_JOURNAL_SIZE);
+        assert(cursor == NK_GAMEPAD_JOURNAL_SIZE + 5);
+        nk_gamepad_free(&gamepads);
+    }
+
+#ifdef TEST_THREADS
+    printf("nk_gamepad_journal_write()\n");
+    {
+        // Entries written from many threads at once are never torn.
+        struct nk_gamepads* gamepads = &test_threads_gamepads;
+        assert(nk_gamepad_init_with_source(gamepads, NULL, test_empty_source) == nk_true);
+        pthread_t threads[TEST_THREADS];
+        int ids[TEST_THREADS];
+        for (int i = 0; i < TEST_THREADS; i++) {
+            ids[i] = i;
+            pthread_create(&threads[i], NULL, &test_writer, &ids[i]);
+        }
+        for (int i = 0; i < TEST_THREADS; i++) {
+            pthread_join(threads[i], NULL);
+        }
+
+        unsigned int cursor = 0;
+        struct nk_gamepad_journal_entry entry;
+        int read = 0;
+        while (nk_gamepad_journal_next(gamepads, &cursor, &entry)) {
+            assert(entry.num == entry.detail);
+            read++;
+        }
+        assert(read == NK_GAMEPAD_JOURNAL_SIZE);
+        assert(gamepads->journal.head == TEST_THREADS * TEST_THREAD_WRITES);
+        nk_gamepad_free(gamepads);
+    }
+#endif
+
+    printf("----------------------------\n");
+    printf("nuklear_gamepad_journal_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,231 @@
+#include <assert.h>
+#include <stdio.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_PATTERNS
+#define NK_GAMEPAD_PATTERNS_MAX 4
+#include "../nuklear_gamepad.h"
+#include "nuklear_gamepad_test_source.h"
+
+/**
+ * Press and release a single button over two updates.
+ */
+static void test_tap(struct nk_gamepads* gamepads, enum nk_gamepad_button button) {
+    test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(button);
+    nk_gamepad_update(gamepads);
+    test_buttons[0] = 0;
+    nk_gamepad_update(gamepads);
+}
+
+int main() {
+    printf("nuklear_gamepad_patterns_test\n");
+    printf("-----------------------------\n");
+
+    struct nk_gamepads gamepads;
+    assert(test_source_init(&gamepads, NULL) == nk_true);
+
+    const unsigned int lb = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LB);
+    const unsigned int rb = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_RB);
+    const unsigned int start = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_START);
+    const unsigned int up = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_UP);
+    const unsigned int down = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_DOWN);
+
+    printf("nk_gamepad_add_pattern()\n");
+    {
+        unsigned int steps[NK_GAMEPAD_PATTERNS_LENGTH + 1] = {0};
+        assert(nk_gamepad_add_pattern(NULL, &lb, 1, 0) == -1);
+        assert(nk_gamepad_add_pattern(&gamepads, NULL, 1, 0) == -1);
+        assert(nk_gamepad_add_pattern(&gamepads, &lb, 0, 0) == -1);
+        assert(nk_gamepad_add_pattern(&gamepads, steps, 1, 0) == -1);
+        steps[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST);
+        assert(nk_gamepad_add_pattern(&gamepads, steps, 1, 0) == -1);
+        assert(nk_gamepad_add_pattern(&gamepads, steps, NK_GAMEPAD_PATTERNS_LENGTH + 1, 0) == -1);
+
+        // A chord of every button doesn't fit in the positions.
+        steps[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST) - 1;
+        assert(nk_gamepad_add_pattern(&gamepads, steps, 1, 0) == -1);
+
+        // Slots are handed out in order, and free again once removed.
+        unsigned int a = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A);
+        for (int i = 0; i < NK_GAMEPAD_PATTERNS_MAX; i++) {
+            assert(nk_gamepad_add_pattern(&gamepads, &a, 1, 0) == i);
+        }
+        assert(nk_gamepad_add_pattern(&gamepads, &a, 1, 0) == -1);
+        for (int i = 0; i < NK_GAMEPAD_PATTERNS_MAX; i++) {
+            nk_gamepad_remove_pattern(&gamepads, i);
+        }
+        assert(nk_gamepad_add_pattern(&gamepads, &a, 1, 0) == 0);
+        nk_gamepad_remove_pattern(&gamepads, 0);
+    }
+
+    printf("nk_gamepad_is_pattern_matched()\n");
+    {
+        unsigned int chord = lb | rb | start;
+        int menu = nk_gamepad_add_pattern(&gamepads, &chord, 1, 0);
+        assert(menu >= 0);
+
+        // The chord is matched when its last button goes down, in any order.
+        test_buttons[0] = rb;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = rb | start;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, menu) == nk_false);
+        test_buttons[0] = rb | start | lb;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, menu) == nk_true);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, -1, menu) == nk_true);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 1, menu) == nk_false);
+
+        // Only for the update it happened in.
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, menu) == nk_false);
+
+        // All at once works too.
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = chord;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, menu) == nk_true);
+
+        // Buttons let go of part way through have to be pressed again.
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = lb | rb;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = lb;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = lb | start;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, menu) == nk_false);
+        test_buttons[0] = chord;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, menu) == nk_true);
+
+        // Sequences of single buttons, alongside the chord.
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        unsigned int code[] = {up, up, down, down};
+        int service = nk_gamepad_add_pattern(&gamepads, code, 4, 0);
+        assert(service >= 0 && service != menu);
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_UP);
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_UP);
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_DOWN);
+        test_buttons[0] = down;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, service) == nk_true);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, menu) == nk_false);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+
+        // A wrong button breaks it, but an extra press of the first one still lines up.
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_UP);
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_A);
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_UP);
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_DOWN);
+        test_buttons[0] = down;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, service) == nk_false);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_UP);
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_UP);
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_UP);
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_DOWN);
+        test_buttons[0] = down;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, service) == nk_true);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+
+        // A chord part way through when the gamepad is unplugged starts over when it comes back.
+        test_buttons[0] = lb | rb;
+        nk_gamepad_update(&gamepads);
+        test_unplugged[0] = nk_true;
+        nk_gamepad_update(&gamepads);
+        test_unplugged[0] = nk_false;
+        test_buttons[0] = chord;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, menu) == nk_false);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = chord;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, menu) == nk_true);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+
+        // Removed patterns are no longer matched.
+        nk_gamepad_remove_pattern(&gamepads, menu);
+        test_buttons[0] = chord;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, menu) == nk_false);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_remove_pattern(&gamepads, service);
+
+        assert(nk_gamepad_is_pattern_matched(NULL, 0, 0) == nk_false);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, NK_GAMEPAD_MAX, 0) == nk_false);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, NK_GAMEPAD_PATTERNS_MAX) == nk_false);
+    }
+
+    printf("nk_gamepad_add_pattern() with a timeout\n");
+    {
+        unsigned int steps[] = {up, down};
+        int fast = nk_gamepad_add_pattern(&gamepads, steps, 2, 100);
+        int patient = nk_gamepad_add_pattern(&gamepads, steps, 2, 1000);
+        assert(fast >= 0 && patient >= 0);
+
+        // Quick enough for both.
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_UP);
+        test_time += 100;
+        test_buttons[0] = down;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, fast) == nk_true);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, patient) == nk_true);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        test_time += 10000;
+
+        // Too slow for the quick one only.
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_UP);
+        test_time += 500;
+        test_buttons[0] = down;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, fast) == nk_false);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, patient) == nk_true);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+
+        // Too slow for either.
+        test_time += 10000;
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_UP);
+        test_time += 1001;
+        test_buttons[0] = down;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, fast) == nk_false);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, patient) == nk_false);
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+
+        // Quick enough for both again.
+        test_time += 10000;
+        test_tap(&gamepads, NK_GAMEPAD_BUTTON_UP);
+        test_time += 50;
+        test_buttons[0] = down;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, fast) == nk_true);
+        assert(nk_gamepad_is_pattern_matched(&gamepads, 0, patient) == nk_true);
+    }
+
+    nk_gamepad_free(&gamepads);
+
+    printf("-----------------------------\n");
+    printf("nuklear_gamepad_patterns_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#include "../nuklear_gamepad.h"
+#include "../nuklear_gamepad_record.h"
+
+#define TEST_FRAMES 10000
+
+/**
+ * A scripted input source: mostly idle, with a few presses and a disconnect, like a long soak test.
+ */
+static unsigned int test_script(int frame, int num) {
+    if (num == 1 && frame >= 5000 && frame < 6000) {
+        return 0xFFFFFFFFu; // Disconnected.
+    }
+    if (frame % 1000 < 10) {
+        return NK_GAMEPAD_BUTTON_FLAG((frame / 1000 + num) % NK_GAMEPAD_BUTTON_LAST);
+    }
+    if (num == 0 && frame >= 200 && frame < 400) {
+        return NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LB);
+    }
+    return 0;
+}
+
+static void test_script_update(struct nk_gamepads* gamepads, void* user_data) {
+    int* frame = (int*)user_data;
+    for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+        unsigned int buttons = test_script(*frame, num);
+        gamepads->gamepads[num].available = buttons != 0xFFFFFFFFu;
+        for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
+            nk_gamepad_button(gamepads, num, (enum nk_gamepad_button)i, (buttons & NK_GAMEPAD_BUTTON_FLAG(i)) != 0);
+        }
+    }
+    (*frame)++;
+}
+
+int main() {
+    printf("nuklear_gamepad_record_test\n");
+    printf("---------------------------\n");
+
+    const char* path = "nuklear_gamepad_record_test.nkgp";
+
+    printf("nk_gamepad_recorder_open()\n");
+    static struct nk_gamepad_recorder recorder;
+    {
+        int frame = 0;
+        struct nk_gamepad_input_source script = {
+            .user_data = &frame,
+            .update = &test_script_update,
+        };
+        assert(nk_gamepad_recorder_open(&recorder, path, script) == nk_true);
+
+        struct nk_gamepads gamepads;
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_recorder_input_source(&recorder)) == nk_true);
+        for (int i = 0; i < TEST_FRAMES; i++) {
+            nk_gamepad_update(&gamepads);
+        }
+        assert(recorder.frames == TEST_FRAMES);
+
+        // Freeing the gamepads finishes the trace.
+        nk_gamepad_free(&gamepads);
+        assert(recorder.file == NULL);
+    }
+
+    printf("nk_gamepad_replay_open_file()\n");
+    struct nk_gamepad_replay replay;
+    {
+        assert(nk_gamepad_replay_open_file(&replay, path) == nk_true);
+        assert(replay.count == NK_GAMEPAD_MAX);
+
+        // Only the changes are stored, so ten thousand frames fit in a few hundred bytes.
+        assert(replay.size < 1024);
+    }
+
+    printf("nk_gamepad_replay_input_source()\n");
+    {
+        struct nk_gamepads gamepads;
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_replay_input_source(&replay)) == nk_true);
+        for (int frame = 0; frame < TEST_FRAMES; frame++) {
+            assert(nk_gamepad_replay_finished(&replay) == nk_false);
+            nk_gamepad_update(&gamepads);
+            for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+                unsigned int expected = test_script(frame, num);
+                if (expected == 0xFFFFFFFFu) {
+                    assert(nk_gamepad_is_available(&gamepads, num) == nk_false);
+                }
+                else {
+                    assert(nk_gamepad_is_available(&gamepads, num) == nk_true);
+                    assert(gamepads.gamepads[num].buttons == expected);
+                }
+            }
+        }
+        assert(replay.frame == TEST_FRAMES);
+
+        // The last frame has been played.
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_replay_finished(&replay) == nk_true);
+        nk_gamepad_free(&gamepads);
+    }
+
+    printf("nk_gamepad_replay_close()\n");
+    {
+        nk_gamepad_replay_close(&replay);
+        assert(replay.data == NULL);
+        assert(nk_gamepad_replay_finished(&replay) == nk_true);
+        remove(path);
+    }
+
+    printf("nk_gamepad_replay_open_memory()\n");
+    {
+        // Gamepad 0 connects, then presses A, looping.
+        const unsigned char trace[] = {
+            'N', 'K', 'G', 'P', 1, NK_GAMEPAD_MAX,
+            0, 1, 0, 0x80, 0x80, 0x80, 0x80, 0x08,
+            0, 1, 0, NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A),
+            0, 0
+        };
+        assert(nk_gamepad_replay_open_memory(&replay, "not a trace", 11) == nk_false);
+        assert(nk_gamepad_replay_open_memory(&replay, trace, sizeof(trace)) == nk_true);
+        replay.loop = nk_true;
+
+        struct nk_gamepads gamepads;
+        nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_replay_input_source(&replay));
+        for (int i = 0; i < 3; i++) {
+            nk_gamepad_update(&gamepads);
+            assert(nk_gamepad_is_available(&gamepads, 0) == nk_true);
+            assert(gamepads.gamepads[0].buttons == 0);
+            nk_gamepad_update(&gamepads);
+            assert(nk_gamepad_is_button_pressed(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+        }
+        assert(nk_gamepad_replay_finished(&replay) == nk_false);
+        nk_gamepad_free(&gamepads);
+    }
+
+    printf("nk_gamepad_replay_input_source() with an empty trace\n");
+    {
+        // A recorder closed before any updates writes a trace without frames.
+        int frame = 0;
+        struct nk_gamepad_input_source script = {
+            .user_data = &frame,
+            .update = &test_script_update,
+        };
+        assert(nk_gamepad_recorder_open(&recorder, path, script) == nk_true);
+        struct nk_gamepads gamepads;
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_recorder_input_source(&recorder)) == nk_true);
+        nk_gamepad_free(&gamepads);
+
+        // Looping it finishes, rather than starting over forever.
+        assert(nk_gamepad_replay_open_file(&replay, path) == nk_true);
+        replay.loop = nk_true;
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_replay_input_source(&replay)) == nk_true);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_replay_finished(&replay) == nk_true);
+        assert(nk_gamepad_is_available(&gamepads, 0) == nk_false);
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_free(&gamepads);
+        nk_gamepad_replay_close(&replay);
+        remove(path);
+    }
+
+    printf("---------------------------\n");
+    printf("nuklear_gamepad_record_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+#include <assert.h>
+#include <stdio.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_STATS
+#include "../nuklear_gamepad.h"
+
+#define TEST_A NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A)
+#define TEST_START NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_START)
+
+// The buttons the input source reports on each update, and whether the first gamepad is plugged in. Like a real input
+// source, the buttons of an unplugged gamepad are left as they were.
+static unsigned int test_buttons = 0;
+static nk_bool test_connected = nk_true;
+
+static nk_bool test_init(struct nk_gamepads* gamepads, void* user_data) {
+    NK_UNUSED(user_data);
+    gamepads->gamepads[0].available = nk_true;
+    return nk_true;
+}
+
+static void test_update(struct nk_gamepads* gamepads, void* user_data) {
+    NK_UNUSED(user_data);
+    gamepads->gamepads[0].available = test_connected;
+    if (test_connected) {
+        gamepads->gamepads[0].buttons = test_buttons;
+    }
+}
+
+int main() {
+    printf("nuklear_gamepad_stats_test\n");
+    printf("--------------------------\n");
+
+    struct nk_gamepads gamepads;
+    struct nk_gamepad_input_source source = {
+        .init = &test_init,
+        .update = &test_update,
+    };
+    assert(nk_gamepad_init_with_source(&gamepads, NULL, source) == nk_true);
+
+    printf("nk_gamepad_stats()\n");
+    {
+        assert(nk_gamepad_stats(NULL, 0) == NULL);
+        assert(nk_gamepad_stats(&gamepads, -1) == NULL);
+        assert(nk_gamepad_stats(&gamepads, NK_GAMEPAD_MAX) == NULL);
+
+        const struct nk_gamepad_stats* stats = nk_gamepad_stats(&gamepads, 0);
+        assert(stats != NULL);
+
+        // Being available from the start isn't a connection.
+        nk_gamepad_update(&gamepads);
+        assert(stats->connects == 0);
+        assert(stats->idle == 1);
+
+        // Hold A for three updates, with START pressed in the middle.
+        test_buttons = TEST_A;
+        nk_gamepad_update(&gamepads);
+        assert(stats->presses[NK_GAMEPAD_BUTTON_A] == 1);
+        assert(stats->idle == 0);
+        test_buttons = TEST_A | TEST_START;
+        nk_gamepad_update(&gamepads);
+        test_buttons = TEST_A;
+        nk_gamepad_update(&gamepads);
+        assert(stats->hold[NK_GAMEPAD_BUTTON_A] == 3);
+        assert(stats->held[NK_GAMEPAD_BUTTON_START] == 1);
+        assert(stats->hold[NK_GAMEPAD_BUTTON_START] == 0);
+
+        // Releasing ends the current hold, and keeps the total.
+        test_buttons = 0;
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_update(&gamepads);
+        assert(stats->hold[NK_GAMEPAD_BUTTON_A] == 0);
+        assert(stats->held[NK_GAMEPAD_BUTTON_A] == 3);
+        assert(stats->presses[NK_GAMEPAD_BUTTON_A] == 1);
+        assert(stats->presses[NK_GAMEPAD_BUTTON_START] == 1);
+        assert(stats->presses[NK_GAMEPAD_BUTTON_B] == 0);
+        assert(stats->idle == 1);
+
+        // Unplug with A held, which ends the hold, and the gamepad idles while it is gone.
+        test_buttons = TEST_A;
+        nk_gamepad_update(&gamepads);
+        test_connected = nk_false;
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_update(&gamepads);
+        assert(stats->disconnects == 1);
+        assert(stats->hold[NK_GAMEPAD_BUTTON_A] == 0);
+        assert(stats->held[NK_GAMEPAD_BUTTON_A] == 4);
+        assert(stats->idle == 3);
+
+        // Plugging back in with nothing held keeps idling.
+        test_buttons = 0;
+        test_connected = nk_true;
+        nk_gamepad_update(&gamepads);
+        assert(stats->connects == 1);
+        assert(stats->idle == 4);
+        assert(stats->presses[NK_GAMEPAD_BUTTON_A] == 2);
+
+        // Other gamepads are untouched.
+        assert(nk_gamepad_stats(&gamepads, 1)->idle == 11);
+        assert(nk_gamepad_stats(&gamepads, 1)->connects == 0);
+    }
+
+    printf("nk_gamepad_stats_reset()\n");
+    {
+        test_buttons = TEST_A;
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_stats_reset(&gamepads, 0);
+        const struct nk_gamepad_stats* stats = nk_gamepad_stats(&gamepads, 0);
+        assert(stats->presses[NK_GAMEPAD_BUTTON_A] == 0);
+        assert(stats->connects == 0);
+        assert(nk_gamepad_stats(&gamepads, 1)->idle == 12);
+
+        // A gamepad that is still connected isn't counted again after a reset.
+        nk_gamepad_update(&gamepads);
+        assert(stats->connects == 0);
+        assert(stats->held[NK_GAMEPAD_BUTTON_A] == 1);
+
+        nk_gamepad_stats_reset(&gamepads, -1);
+        assert(nk_gamepad_stats(&gamepads, 1)->idle == 0);
+        nk_gamepad_stats_reset(NULL, -1);
+    }
+
+    nk_gamepad_free(&gamepads);
+
+    printf("--------------------------\n");
+    printf("nuklear_gamepad_stats_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_MAX 64
+#include "../nuklear_gamepad.h"
+#include "../nuklear_gamepad_stress.h"
+
+int main() {
+    printf("nuklear_gamepad_stress_test\n");
+    printf("---------------------------\n");
+
+    printf("nk_gamepad_stress_setup()\n");
+    struct nk_gamepad_stress stress_a, stress_b, stress_c;
+    {
+        nk_gamepad_stress_setup(&stress_a, 1234, 48, 0.05f, 2, 6);
+        nk_gamepad_stress_setup(&stress_b, 1234, 48, 0.05f, 2, 6);
+        nk_gamepad_stress_setup(&stress_c, 4321, 48, 0.05f, 2, 6);
+        assert(stress_a.pads == 48);
+        assert(stress_a.press_chance > 0 && stress_a.press_chance < 65536);
+    }
+
+    printf("nk_gamepad_stress_input_source()\n");
+    {
+        struct nk_gamepads a, b, c;
+        assert(nk_gamepad_init_with_source(&a, NULL, nk_gamepad_stress_input_source(&stress_a)) == nk_true);
+        assert(nk_gamepad_init_with_source(&b, NULL, nk_gamepad_stress_input_source(&stress_b)) == nk_true);
+        assert(nk_gamepad_init_with_source(&c, NULL, nk_gamepad_stress_input_source(&stress_c)) == nk_true);
+        assert(nk_gamepad_is_available(&a, 47) == nk_true);
+        assert(nk_gamepad_is_available(&a, 48) == nk_false);
+
+        // Count how long each press is held for.
+        int held[NK_GAMEPAD_MAX][NK_GAMEPAD_BUTTON_LAST];
+        memset(held, 0, sizeof(held));
+        nk_bool differs = nk_false;
+        for (int frame = 0; frame < 1000; frame++) {
+            nk_gamepad_update(&a);
+            nk_gamepad_update(&b);
+            nk_gamepad_update(&c);
+
+            for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+                // The same seed gives the same traffic.
+                assert(a.gamepads[num].buttons == b.gamepads[num].buttons);
+                if (a.gamepads[num].buttons != c.gamepads[num].buttons) {
+                    differs = nk_true;
+                }
+
+                for (int i = NK_GAMEPAD_BUTTON_FIRST; i < NK_GAMEPAD_BUTTON_LAST; i++) {
+                    if (nk_gamepad_is_button_down(&a, num, (enum nk_gamepad_button)i)) {
+                        held[num][i]++;
+                    }
+                    else if (nk_gamepad_is_button_released(&a, num, (enum nk_gamepad_button)i)) {
+                        assert(held[num][i] >= 2 && held[num][i] <= 6);
+                        held[num][i] = 0;
+                    }
+                }
+            }
+        }
+        assert(differs == nk_true);
+
+        // Roughly one press every 20 + 4 frames per button.
+        assert(stress_a.presses > 48 * NK_GAMEPAD_BUTTON_LAST * 1000 / 48);
+        assert(stress_a.presses < 48 * NK_GAMEPAD_BUTTON_LAST * 1000 / 12);
+        assert(stress_a.presses == stress_b.presses);
+
+        nk_gamepad_free(&a);
+        nk_gamepad_free(&b);
+        nk_gamepad_free(&c);
+    }
+
+    printf("nk_gamepad_stress_input_source() idle\n");
+    {
+        struct nk_gamepad_stress idle;
+        struct nk_gamepads gamepads;
+        nk_gamepad_stress_setup(&idle, 1, -1, 0.0f, 1, 1);
+        nk_gamepad_init_with_source(&gamepads, NULL, nk_gamepad_stress_input_source(&idle));
+        for (int frame = 0; frame < 100; frame++) {
+            nk_gamepad_update(&gamepads);
+            assert(nk_gamepad_any_button_pressed(&gamepads, -1, NULL, NULL) == nk_false);
+        }
+        assert(nk_gamepad_is_available(&gamepads, NK_GAMEPAD_MAX - 1) == nk_true);
+        nk_gamepad_free(&gamepads);
+    }
+
+    printf("---------------------------\n");
+    printf("nuklear_gamepad_stress_test: Tests passed!\n");
+
+    return 0;
+}
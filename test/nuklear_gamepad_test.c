@@ -68,6 +68,77 @@ int main() {
     assert(num == 0);
     assert(button == NK_GAMEPAD_BUTTON_A);
 
+    printf("nk_gamepad_set_buttons()\n");
+    {
+        nk_gamepad_set_buttons(&gamepads, 1, NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_X) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_START));
+        assert(nk_gamepad_is_button_down(&gamepads, 1, NK_GAMEPAD_BUTTON_X) == nk_true);
+        assert(nk_gamepad_is_button_down(&gamepads, 1, NK_GAMEPAD_BUTTON_START) == nk_true);
+        assert(nk_gamepad_is_button_down(&gamepads, 1, NK_GAMEPAD_BUTTON_A) == nk_false);
+
+        // The whole state is replaced, and unknown buttons are dropped.
+        nk_gamepad_set_buttons(&gamepads, 1, NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_Y) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LAST));
+        assert(gamepads.gamepads[1].buttons == NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_Y));
+
+        // Invalid gamepads are ignored.
+        nk_gamepad_set_buttons(NULL, 1, 1);
+        nk_gamepad_set_buttons(&gamepads, -1, 1);
+        nk_gamepad_set_buttons(&gamepads, NK_GAMEPAD_MAX, 1);
+    }
+
+    printf("nk_gamepad_input_source.persistent\n");
+    {
+        // Buttons are cleared on every update by default.
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_down(&gamepads, 1, NK_GAMEPAD_BUTTON_Y) == nk_false);
+
+        // Persistent sources keep them until they change.
+        nk_gamepad_input_source(&gamepads)->persistent = nk_true;
+        NK_GAMEPAD_SET_BUTTONS(&gamepads, 1, NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_B));
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_down(&gamepads, 1, NK_GAMEPAD_BUTTON_B) == nk_true);
+        assert(nk_gamepad_is_button_pressed(&gamepads, 1, NK_GAMEPAD_BUTTON_B) == nk_false);
+        nk_gamepad_button(&gamepads, 1, NK_GAMEPAD_BUTTON_B, nk_false);
+        assert(nk_gamepad_is_button_released(&gamepads, 1, NK_GAMEPAD_BUTTON_B) == nk_true);
+        nk_gamepad_input_source(&gamepads)->persistent = nk_false;
+    }
+
+    printf("nk_gamepad_consumer_update()\n");
+    {
+        // Two consumers updating at different rates each see the press once.
+        struct nk_gamepad_consumer fast;
+        struct nk_gamepad_consumer slow;
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_consumer_init(&fast, &gamepads);
+        nk_gamepad_consumer_init(&slow, &gamepads);
+
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_button(&gamepads, 1, NK_GAMEPAD_BUTTON_X, nk_true);
+        nk_gamepad_consumer_update(&fast);
+        assert(nk_gamepad_consumer_is_button_pressed(&fast, 1, NK_GAMEPAD_BUTTON_X) == nk_true);
+        assert(nk_gamepad_consumer_is_button_down(&fast, -1, NK_GAMEPAD_BUTTON_X) == nk_true);
+
+        nk_gamepad_input_source(&gamepads)->persistent = nk_true;
+        nk_gamepad_update(&gamepads);
+        nk_gamepad_consumer_update(&fast);
+        assert(nk_gamepad_consumer_is_button_pressed(&fast, 1, NK_GAMEPAD_BUTTON_X) == nk_false);
+        assert(nk_gamepad_consumer_is_button_down(&fast, 1, NK_GAMEPAD_BUTTON_X) == nk_true);
+
+        nk_gamepad_consumer_update(&slow);
+        assert(nk_gamepad_consumer_is_button_pressed(&slow, -1, NK_GAMEPAD_BUTTON_X) == nk_true);
+        nk_gamepad_consumer_update(&slow);
+        assert(nk_gamepad_consumer_is_button_pressed(&slow, 1, NK_GAMEPAD_BUTTON_X) == nk_false);
+
+        nk_gamepad_button(&gamepads, 1, NK_GAMEPAD_BUTTON_X, nk_false);
+        nk_gamepad_input_source(&gamepads)->persistent = nk_false;
+        nk_gamepad_consumer_update(&slow);
+        assert(nk_gamepad_consumer_is_button_released(&slow, 1, NK_GAMEPAD_BUTTON_X) == nk_true);
+        assert(nk_gamepad_consumer_is_button_released(&fast, 1, NK_GAMEPAD_BUTTON_X) == nk_false);
+
+        // Consumers don't change the state seen by everyone else.
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_down(&gamepads, 1, NK_GAMEPAD_BUTTON_X) == nk_false);
+    }
+
     printf("nk_gamepad_free()\n");
     nk_gamepad_free(&gamepads);
 
@@ -0,0 +1,63 @@
+#ifndef NUKLEAR_GAMEPAD_TEST_SOURCE_H__
+#define NUKLEAR_GAMEPAD_TEST_SOURCE_H__
+
+/**
+ * A scripted input source and a manual clock, shared by the tests that drive nk_gamepad_update() by hand.
+ *
+ * Include this after the nuklear_gamepad.h implementation, then set up the gamepads with test_source_init(). Tests
+ * hold buttons by setting test_buttons, unplug gamepads with test_unplugged, and move time along by changing test_time.
+ */
+
+#ifndef TEST_SOURCE_GAMEPADS
+/**
+ * How many gamepads the scripted source publishes buttons for.
+ */
+#define TEST_SOURCE_GAMEPADS 2
+#endif
+
+/**
+ * The buttons held on each scripted gamepad, published on every update.
+ */
+static unsigned int test_buttons[TEST_SOURCE_GAMEPADS];
+
+/**
+ * Whether each scripted gamepad is unplugged. Like a real input source, an unplugged gamepad's buttons are left as
+ * they were.
+ */
+static nk_bool test_unplugged[TEST_SOURCE_GAMEPADS];
+
+/**
+ * A manual clock, moved along by the tests.
+ */
+static nk_gamepad_time test_time = 1000;
+
+static void test_update(struct nk_gamepads* gamepads, void* user_data) {
+    NK_UNUSED(user_data);
+    for (int num = 0; num < TEST_SOURCE_GAMEPADS; num++) {
+        gamepads->gamepads[num].available = test_unplugged[num] ? nk_false : nk_true;
+        if (!test_unplugged[num]) {
+            NK_GAMEPAD_SET_BUTTONS(gamepads, num, test_buttons[num]);
+        }
+    }
+}
+
+static nk_gamepad_time test_clock(void* user_data) {
+    NK_UNUSED(user_data);
+    return test_time;
+}
+
+/**
+ * Initialize the gamepads with the scripted input source, timed by the manual clock.
+ */
+static nk_bool test_source_init(struct nk_gamepads* gamepads, struct nk_context* ctx) {
+    struct nk_gamepad_input_source source = {
+        .update = &test_update,
+    };
+    if (!nk_gamepad_init_with_source(gamepads, ctx, source)) {
+        return nk_false;
+    }
+    nk_gamepad_set_clock(gamepads, &test_clock, NULL);
+    return nk_true;
+}
+
+#endif
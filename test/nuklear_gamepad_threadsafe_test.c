@@ -0,0 +1,145 @@
+#include <assert.h>
+#include <stdio.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define TEST_THREADS 4
+#define TEST_THREAD_PRESSES 10000
+#include <pthread.h>
+#endif
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_THREADSAFE
+#include "../nuklear_gamepad.h"
+
+#ifdef TEST_THREADS
+static struct nk_gamepads test_threads_gamepads;
+
+/**
+ * Press and release a button of its own many times, then leave it held down.
+ */
+static void* test_producer(void* data) {
+    enum nk_gamepad_button button = *(enum nk_gamepad_button*)data;
+    for (int i = 0; i < TEST_THREAD_PRESSES; i++) {
+        nk_gamepad_button_async(&test_threads_gamepads, 0, button, nk_true);
+        nk_gamepad_button_async(&test_threads_gamepads, 0, button, nk_false);
+    }
+    nk_gamepad_button_async(&test_threads_gamepads, 0, button, nk_true);
+    return NULL;
+}
+#endif
+
+int main() {
+    printf("nuklear_gamepad_threadsafe_test\n");
+    printf("-------------------------------\n");
+
+    struct nk_gamepads gamepads;
+    assert(nk_gamepad_init(&gamepads, NULL, NULL) == nk_true);
+
+    printf("nk_gamepad_button_async()\n");
+    {
+        // Staged buttons only show up on the next update.
+        nk_gamepad_button_async(&gamepads, 0, NK_GAMEPAD_BUTTON_A, nk_true);
+        assert(nk_gamepad_is_button_down(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_pressed(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+
+        // Held buttons stay down across updates.
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_down(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+        assert(nk_gamepad_is_button_pressed(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+
+        nk_gamepad_button_async(&gamepads, 0, NK_GAMEPAD_BUTTON_A, nk_false);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_released(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+
+        // A tap between two updates is still seen, for one update.
+        nk_gamepad_button_async(&gamepads, 1, NK_GAMEPAD_BUTTON_B, nk_true);
+        nk_gamepad_button_async(&gamepads, 1, NK_GAMEPAD_BUTTON_B, nk_false);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_pressed(&gamepads, 1, NK_GAMEPAD_BUTTON_B) == nk_true);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_released(&gamepads, 1, NK_GAMEPAD_BUTTON_B) == nk_true);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_down(&gamepads, 1, NK_GAMEPAD_BUTTON_B) == nk_false);
+
+        // Invalid gamepads and buttons are ignored.
+        nk_gamepad_button_async(NULL, 0, NK_GAMEPAD_BUTTON_A, nk_true);
+        nk_gamepad_button_async(&gamepads, -1, NK_GAMEPAD_BUTTON_A, nk_true);
+        nk_gamepad_button_async(&gamepads, NK_GAMEPAD_MAX, NK_GAMEPAD_BUTTON_A, nk_true);
+        nk_gamepad_button_async(&gamepads, 0, NK_GAMEPAD_BUTTON_LAST, nk_true);
+        nk_gamepad_update(&gamepads);
+        assert(gamepads.gamepads[0].buttons == 0);
+    }
+
+    nk_gamepad_free(&gamepads);
+
+    printf("nk_gamepad_button_async() with a persistent input source\n");
+    {
+        // The buttons aren't cleared between updates, so releases have to be merged in too.
+        struct nk_gamepad_input_source source = {
+            .persistent = nk_true,
+        };
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, source) == nk_true);
+        nk_gamepad_button_async(&gamepads, 0, NK_GAMEPAD_BUTTON_A, nk_true);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_pressed(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_down(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+        nk_gamepad_button_async(&gamepads, 0, NK_GAMEPAD_BUTTON_A, nk_false);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_released(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_true);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_down(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == nk_false);
+
+        // Taps are let go of after their one update as well.
+        nk_gamepad_button_async(&gamepads, 0, NK_GAMEPAD_BUTTON_B, nk_true);
+        nk_gamepad_button_async(&gamepads, 0, NK_GAMEPAD_BUTTON_B, nk_false);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_pressed(&gamepads, 0, NK_GAMEPAD_BUTTON_B) == nk_true);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_released(&gamepads, 0, NK_GAMEPAD_BUTTON_B) == nk_true);
+
+        // Buttons the input source set itself are left alone.
+        nk_gamepad_button(&gamepads, 0, NK_GAMEPAD_BUTTON_X, nk_true);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_is_button_down(&gamepads, 0, NK_GAMEPAD_BUTTON_X) == nk_true);
+        nk_gamepad_free(&gamepads);
+    }
+
+#ifdef TEST_THREADS
+    printf("nk_gamepad_button_async() from many threads\n");
+    {
+        // Producers racing each other and the updates never lose a button.
+        struct nk_gamepads* threaded = &test_threads_gamepads;
+        assert(nk_gamepad_init(threaded, NULL, NULL) == nk_true);
+        pthread_t threads[TEST_THREADS];
+        enum nk_gamepad_button buttons[TEST_THREADS];
+        unsigned int expected = 0;
+        for (int i = 0; i < TEST_THREADS; i++) {
+            buttons[i] = (enum nk_gamepad_button)(NK_GAMEPAD_BUTTON_A + i);
+            expected |= NK_GAMEPAD_BUTTON_FLAG(buttons[i]);
+            pthread_create(&threads[i], NULL, &test_producer, &buttons[i]);
+        }
+        for (int i = 0; i < 1000; i++) {
+            nk_gamepad_update(threaded);
+        }
+        for (int i = 0; i < TEST_THREADS; i++) {
+            pthread_join(threads[i], NULL);
+        }
+
+        nk_gamepad_update(threaded);
+        assert(threaded->gamepads[0].buttons == expected);
+        nk_gamepad_free(threaded);
+    }
+#endif
+
+    printf("-------------------------------\n");
+    printf("nuklear_gamepad_threadsafe_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <assert.h>
+#include <stdio.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_TIMESTAMPS
+#include "../nuklear_gamepad.h"
+#include "nuklear_gamepad_test_source.h"
+
+int main() {
+    printf("nuklear_gamepad_timestamps_test\n");
+    printf("-------------------------------\n");
+
+    struct nk_gamepads gamepads;
+    assert(test_source_init(&gamepads, NULL) == nk_true);
+
+    printf("nk_gamepad_set_clock()\n");
+    {
+        nk_gamepad_set_clock(&gamepads, &test_clock, NULL);
+        nk_gamepad_update(&gamepads);
+        assert(gamepads.time == 1000);
+    }
+
+    printf("nk_gamepad_button_held_time()\n");
+    {
+        assert(nk_gamepad_button_held_time(&gamepads, 0, NK_GAMEPAD_BUTTON_X) == 0);
+
+        test_time = 2000;
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_X);
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_button_held_time(&gamepads, 0, NK_GAMEPAD_BUTTON_X) == 0);
+        assert(gamepads.gamepads[0].pressed_at[NK_GAMEPAD_BUTTON_X] == 2000);
+
+        test_time = 2500;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_button_held_time(&gamepads, 0, NK_GAMEPAD_BUTTON_X) == 500);
+
+        // The time is as of the latest update, not when it is asked for.
+        test_time = 9000;
+        assert(nk_gamepad_button_held_time(&gamepads, 0, NK_GAMEPAD_BUTTON_X) == 500);
+
+        // Invalid arguments.
+        assert(nk_gamepad_button_held_time(NULL, 0, NK_GAMEPAD_BUTTON_X) == 0);
+        assert(nk_gamepad_button_held_time(&gamepads, -1, NK_GAMEPAD_BUTTON_X) == 0);
+        assert(nk_gamepad_button_held_time(&gamepads, 0, NK_GAMEPAD_BUTTON_LAST) == 0);
+    }
+
+    printf("nk_gamepad_button_released_time()\n");
+    {
+        assert(nk_gamepad_button_released_time(&gamepads, 0, NK_GAMEPAD_BUTTON_X) == 0);
+        assert(nk_gamepad_button_released_time(&gamepads, 0, NK_GAMEPAD_BUTTON_A) == 0);
+
+        test_time = 3000;
+        test_buttons[0] = 0;
+        nk_gamepad_update(&gamepads);
+        test_time = 3750;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_button_released_time(&gamepads, 0, NK_GAMEPAD_BUTTON_X) == 750);
+        assert(nk_gamepad_button_held_time(&gamepads, 0, NK_GAMEPAD_BUTTON_X) == 0);
+
+        // Pressing again starts a new hold.
+        test_time = 4000;
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_X);
+        nk_gamepad_update(&gamepads);
+        test_time = 4100;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_button_held_time(&gamepads, 0, NK_GAMEPAD_BUTTON_X) == 100);
+        assert(nk_gamepad_button_released_time(&gamepads, 0, NK_GAMEPAD_BUTTON_X) == 0);
+
+        // Releases are kept even when the clock read 0.
+        test_time = 0;
+        test_buttons[0] |= NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_Y);
+        nk_gamepad_update(&gamepads);
+        test_buttons[0] = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_X);
+        nk_gamepad_update(&gamepads);
+        test_time = 50;
+        nk_gamepad_update(&gamepads);
+        assert(nk_gamepad_button_released_time(&gamepads, 0, NK_GAMEPAD_BUTTON_Y) == 50);
+    }
+
+    printf("nk_gamepad_set_clock(NULL)\n");
+    {
+        nk_gamepad_set_clock(&gamepads, NULL, NULL);
+        nk_gamepad_update(&gamepads);
+        assert(gamepads.time != test_time);
+    }
+
+    nk_gamepad_free(&gamepads);
+
+    printf("-------------------------------\n");
+    printf("nuklear_gamepad_timestamps_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+// Record the profiler zones, and make sure they are always balanced.
+static const char* test_zones[16];
+static int test_zone_count = 0;
+static int test_zone_depth = 0;
+#define NK_GAMEPAD_TRACE_BEGIN(name) (test_zones[test_zone_count++ % 16] = (name), test_zone_depth++)
+#define NK_GAMEPAD_TRACE_END(name) (assert(strcmp(test_zones[(test_zone_count - 1) % 16], (name)) == 0), test_zone_depth--)
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#define NK_GAMEPAD_TRACE
+#include "../nuklear_gamepad.h"
+
+static nk_bool test_init(struct nk_gamepads* gamepads, void* user_data) {
+    NK_UNUSED(gamepads);
+    NK_UNUSED(user_data);
+    assert(test_zone_depth == 1);
+    return nk_true;
+}
+
+static void test_update(struct nk_gamepads* gamepads, void* user_data) {
+    NK_UNUSED(user_data);
+    assert(test_zone_depth == 1);
+    for (int num = 0; num < 2; num++) {
+        NK_GAMEPAD_TRACE_COUNT(gamepads, pads_scanned, 1);
+    }
+    NK_GAMEPAD_TRACE_COUNT(gamepads, events, 3);
+}
+
+static const char* test_name(struct nk_gamepads* gamepads, int num, void* user_data) {
+    NK_UNUSED(user_data);
+    return gamepads->gamepads[num].name;
+}
+
+int main() {
+    printf("nuklear_gamepad_trace_test\n");
+    printf("--------------------------\n");
+
+    struct nk_gamepads gamepads;
+    struct nk_gamepad_input_source source = {
+        .init = &test_init,
+        .update = &test_update,
+        .name = &test_name,
+    };
+
+    printf("nk_gamepad_init_with_source()\n");
+    {
+        assert(nk_gamepad_init_with_source(&gamepads, NULL, source) == nk_true);
+        assert(test_zone_count == 1);
+        assert(strcmp(test_zones[0], "nk_gamepad_init") == 0);
+        assert(gamepads.trace.backend_calls == 1);
+        assert(gamepads.trace.frames == 0);
+    }
+
+    printf("nk_gamepad_update()\n");
+    {
+        nk_gamepad_update(&gamepads);
+        assert(strcmp(test_zones[1], "nk_gamepad_update") == 0);
+        assert(gamepads.trace.backend_calls == 1);
+        assert(gamepads.trace.pads_scanned == 2);
+        assert(gamepads.trace.events == 3);
+
+        // The frame counters start over, and the totals keep going.
+        nk_gamepad_update(&gamepads);
+        assert(gamepads.trace.backend_calls == 1);
+        assert(gamepads.trace.pads_scanned == 2);
+        assert(gamepads.trace.total_backend_calls == 3);
+        assert(gamepads.trace.total_pads_scanned == 4);
+        assert(gamepads.trace.total_events == 6);
+        assert(gamepads.trace.frames == 2);
+    }
+
+    printf("nk_gamepad_name()\n");
+    {
+        assert(strcmp(nk_gamepad_name(&gamepads, 0), "Controller 1") == 0);
+        assert(strcmp(test_zones[3], "nk_gamepad_name") == 0);
+        assert(gamepads.trace.total_backend_calls == 4);
+    }
+
+    printf("NK_GAMEPAD_TRACE_COUNT()\n");
+    {
+        // Events handled between updates, like SDL's, count towards the next frame.
+        NK_GAMEPAD_TRACE_COUNT(&gamepads, events, 2);
+        assert(gamepads.trace.backend_calls == 1);
+        assert(gamepads.trace.events == 3);
+        nk_gamepad_update(&gamepads);
+        assert(gamepads.trace.backend_calls == 2);
+        assert(gamepads.trace.events == 5);
+    }
+
+    printf("nk_gamepad_free()\n");
+    {
+        source.free = NULL;
+        nk_gamepad_free(&gamepads);
+        assert(test_zone_count == 5);
+        assert(test_zone_depth == 0);
+    }
+
+    printf("--------------------------\n");
+    printf("nuklear_gamepad_trace_test: Tests passed!\n");
+
+    return 0;
+}
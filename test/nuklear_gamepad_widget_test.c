@@ -0,0 +1,74 @@
+#include <assert.h>
+#include <stdio.h>
+
+#define NK_INCLUDE_DEFAULT_ALLOCATOR
+#define NK_IMPLEMENTATION
+#include "../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_IMPLEMENTATION
+#define NK_GAMEPAD_NONE
+#include "../nuklear_gamepad.h"
+#include "../nuklear_gamepad_widget.h"
+
+static nk_bool test_init(struct nk_gamepads* gamepads, void* user_data) {
+    NK_UNUSED(user_data);
+    gamepads->gamepads[0].available = nk_true;
+    gamepads->gamepads[0].buttons = NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_A) | NK_GAMEPAD_BUTTON_FLAG(NK_GAMEPAD_BUTTON_LB);
+    return nk_true;
+}
+
+static float test_font_width(nk_handle handle, float height, const char* text, int len) {
+    NK_UNUSED(handle);
+    NK_UNUSED(text);
+    return height * 0.5f * (float)len;
+}
+
+int main() {
+    printf("nuklear_gamepad_widget_test\n");
+    printf("---------------------------\n");
+
+    struct nk_gamepads gamepads;
+    struct nk_gamepad_input_source source = {
+        .init = &test_init,
+    };
+    assert(nk_gamepad_init_with_source(&gamepads, NULL, source) == nk_true);
+
+    struct nk_user_font font;
+    font.userdata = nk_handle_ptr(NULL);
+    font.height = 13;
+    font.width = &test_font_width;
+
+    struct nk_context ctx;
+    assert(nk_init_default(&ctx, &font) == nk_true);
+
+    printf("nk_gamepad_widget()\n");
+    {
+        assert(nk_gamepad_widget(NULL, &gamepads, 0) == nk_false);
+        assert(nk_gamepad_widget(&ctx, NULL, 0) == nk_false);
+
+        // Draw a lobby of every gamepad, twice, with the second frame in a different size.
+        for (int frame = 0; frame < 2; frame++) {
+            nk_input_begin(&ctx);
+            nk_input_end(&ctx);
+            if (nk_begin(&ctx, "lobby", nk_rect(0, 0, 640, 480), NK_WINDOW_NO_SCROLLBAR)) {
+                assert(nk_gamepad_widget(&ctx, &gamepads, -1) == nk_false);
+                assert(nk_gamepad_widget(&ctx, &gamepads, NK_GAMEPAD_MAX) == nk_false);
+
+                nk_layout_row_dynamic(&ctx, frame == 0 ? 100.0f : 40.0f, 2);
+                for (int num = 0; num < NK_GAMEPAD_MAX; num++) {
+                    assert(nk_gamepad_widget(&ctx, &gamepads, num) == nk_true);
+                }
+            }
+            nk_end(&ctx);
+            nk_clear(&ctx);
+        }
+    }
+
+    nk_free(&ctx);
+    nk_gamepad_free(&gamepads);
+
+    printf("---------------------------\n");
+    printf("nuklear_gamepad_widget_test: Tests passed!\n");
+
+    return 0;
+}
@@ -0,0 +1,246 @@
+#include <string.h>
+
+#include "../../vendor/nuklear/nuklear.h"
+
+#define NK_GAMEPAD_NONE
+#include "../../nuklear_gamepad.h"
+
+#include "nuklear_gamepad_stubs.h"
+
+struct nk_gamepad_stub_device nk_gamepad_stub_devices[NK_GAMEPAD_STUB_DEVICES];
+struct nk_gamepad_stub_calls nk_gamepad_stub_calls;
+
+struct SDL_GameController {
+    int index;
+};
+
+struct pntr_app {
+    int unused;
+};
+
+static struct SDL_GameController nk_gamepad_stub_controllers[NK_GAMEPAD_STUB_DEVICES];
+static struct pntr_app nk_gamepad_stub_app;
+
+void nk_gamepad_stub_reset(void) {
+    memset(nk_gamepad_stub_devices, 0, sizeof(nk_gamepad_stub_devices));
+    nk_gamepad_stub_reset_calls();
+}
+
+void nk_gamepad_stub_reset_calls(void) {
+    memset(&nk_gamepad_stub_calls, 0, sizeof(nk_gamepad_stub_calls));
+}
+
+unsigned long nk_gamepad_stub_total_calls(void) {
+    const unsigned long* calls = (const unsigned long*)&nk_gamepad_stub_calls;
+    unsigned long total = 0;
+    for (size_t i = 0; i < sizeof(nk_gamepad_stub_calls) / sizeof(unsigned long); i++) {
+        total += calls[i];
+    }
+    return total;
+}
+
+pntr_app* nk_gamepad_stub_pntr_app(void) {
+    return &nk_gamepad_stub_app;
+}
+
+static struct nk_gamepad_stub_device* nk_gamepad_stub_device(int index) {
+    if (index < 0 || index >= NK_GAMEPAD_STUB_DEVICES || !nk_gamepad_stub_devices[index].connected) {
+        return NULL;
+    }
+    return &nk_gamepad_stub_devices[index];
+}
+
+/**
+ * Whether a native button is held, given the table from that library's button to the nuklear_gamepad button.
+ */
+static bool nk_gamepad_stub_button(struct nk_gamepad_stub_device* device, const int* map, int count, int button) {
+    if (device == NULL || button < 0 || button >= count || map[button] < 0) {
+        return false;
+    }
+    return (device->buttons & NK_GAMEPAD_BUTTON_FLAG(map[button])) != 0;
+}
+
+static const char* nk_gamepad_stub_name(struct nk_gamepad_stub_device* device) {
+    if (device == NULL) {
+        return NULL;
+    }
+    return device->name != NULL ? device->name : "";
+}
+
+// SDL2
+
+static const int nk_gamepad_stub_sdl_map[SDL_CONTROLLER_BUTTON_MAX] = {
+    NK_GAMEPAD_BUTTON_A,
+    NK_GAMEPAD_BUTTON_B,
+    NK_GAMEPAD_BUTTON_X,
+    NK_GAMEPAD_BUTTON_Y,
+    NK_GAMEPAD_BUTTON_BACK,
+    NK_GAMEPAD_BUTTON_GUIDE,
+    NK_GAMEPAD_BUTTON_START,
+    -1, // LEFTSTICK
+    -1, // RIGHTSTICK
+    NK_GAMEPAD_BUTTON_LB,
+    NK_GAMEPAD_BUTTON_RB,
+    NK_GAMEPAD_BUTTON_UP,
+    NK_GAMEPAD_BUTTON_DOWN,
+    NK_GAMEPAD_BUTTON_LEFT,
+    NK_GAMEPAD_BUTTON_RIGHT,
+};
+
+SDL_bool SDL_IsGameController(int joystick_index) {
+    nk_gamepad_stub_calls.sdl_is_game_controller++;
+    return nk_gamepad_stub_device(joystick_index) != NULL ? SDL_TRUE : SDL_FALSE;
+}
+
+SDL_GameController* SDL_GameControllerOpen(int joystick_index) {
+    nk_gamepad_stub_calls.sdl_open++;
+    if (nk_gamepad_stub_device(joystick_index) == NULL) {
+        return NULL;
+    }
+    nk_gamepad_stub_controllers[joystick_index].index = joystick_index;
+    return &nk_gamepad_stub_controllers[joystick_index];
+}
+
+void SDL_GameControllerClose(SDL_GameController* gamecontroller) {
+    NK_UNUSED(gamecontroller);
+    nk_gamepad_stub_calls.sdl_close++;
+}
+
+Uint8 SDL_GameControllerGetButton(SDL_GameController* gamecontroller, SDL_GameControllerButton button) {
+    nk_gamepad_stub_calls.sdl_get_button++;
+    if (gamecontroller == NULL) {
+        return 0;
+    }
+    return nk_gamepad_stub_button(nk_gamepad_stub_device(gamecontroller->index), nk_gamepad_stub_sdl_map, SDL_CONTROLLER_BUTTON_MAX, (int)button) ? 1 : 0;
+}
+
+const char* SDL_GameControllerName(SDL_GameController* gamecontroller) {
+    nk_gamepad_stub_calls.sdl_name++;
+    if (gamecontroller == NULL) {
+        return NULL;
+    }
+    return nk_gamepad_stub_name(nk_gamepad_stub_device(gamecontroller->index));
+}
+
+// GLFW
+
+static const int nk_gamepad_stub_glfw_map[GLFW_GAMEPAD_BUTTON_LAST + 1] = {
+    NK_GAMEPAD_BUTTON_A,
+    NK_GAMEPAD_BUTTON_B,
+    NK_GAMEPAD_BUTTON_X,
+    NK_GAMEPAD_BUTTON_Y,
+    NK_GAMEPAD_BUTTON_LB,
+    NK_GAMEPAD_BUTTON_RB,
+    NK_GAMEPAD_BUTTON_BACK,
+    NK_GAMEPAD_BUTTON_START,
+    NK_GAMEPAD_BUTTON_GUIDE,
+    -1, // LEFT_THUMB
+    -1, // RIGHT_THUMB
+    NK_GAMEPAD_BUTTON_UP,
+    NK_GAMEPAD_BUTTON_RIGHT,
+    NK_GAMEPAD_BUTTON_DOWN,
+    NK_GAMEPAD_BUTTON_LEFT,
+};
+
+int glfwJoystickPresent(int jid) {
+    nk_gamepad_stub_calls.glfw_joystick_present++;
+    return nk_gamepad_stub_device(jid) != NULL ? GLFW_TRUE : GLFW_FALSE;
+}
+
+int glfwJoystickIsGamepad(int jid) {
+    nk_gamepad_stub_calls.glfw_joystick_is_gamepad++;
+    return nk_gamepad_stub_device(jid) != NULL ? GLFW_TRUE : GLFW_FALSE;
+}
+
+int glfwGetGamepadState(int jid, GLFWgamepadstate* state) {
+    nk_gamepad_stub_calls.glfw_get_gamepad_state++;
+    struct nk_gamepad_stub_device* device = nk_gamepad_stub_device(jid);
+    if (device == NULL || state == NULL) {
+        return GLFW_FALSE;
+    }
+
+    memset(state, 0, sizeof(GLFWgamepadstate));
+    for (int i = 0; i <= GLFW_GAMEPAD_BUTTON_LAST; i++) {
+        state->buttons[i] = nk_gamepad_stub_button(device, nk_gamepad_stub_glfw_map, GLFW_GAMEPAD_BUTTON_LAST + 1, i) ? 1 : 0;
+    }
+    return GLFW_TRUE;
+}
+
+const char* glfwGetGamepadName(int jid) {
+    nk_gamepad_stub_calls.glfw_get_gamepad_name++;
+    return nk_gamepad_stub_name(nk_gamepad_stub_device(jid));
+}
+
+// raylib
+
+static const int nk_gamepad_stub_raylib_map[GAMEPAD_BUTTON_RIGHT_THUMB + 1] = {
+    -1, // UNKNOWN
+    NK_GAMEPAD_BUTTON_UP,
+    NK_GAMEPAD_BUTTON_RIGHT,
+    NK_GAMEPAD_BUTTON_DOWN,
+    NK_GAMEPAD_BUTTON_LEFT,
+    NK_GAMEPAD_BUTTON_Y,
+    NK_GAMEPAD_BUTTON_B,
+    NK_GAMEPAD_BUTTON_A,
+    NK_GAMEPAD_BUTTON_X,
+    NK_GAMEPAD_BUTTON_LB,
+    -1, // LEFT_TRIGGER_2
+    NK_GAMEPAD_BUTTON_RB,
+    -1, // RIGHT_TRIGGER_2
+    NK_GAMEPAD_BUTTON_BACK,
+    NK_GAMEPAD_BUTTON_GUIDE,
+    NK_GAMEPAD_BUTTON_START,
+    -1, // LEFT_THUMB
+    -1, // RIGHT_THUMB
+};
+
+bool IsGamepadAvailable(int gamepad) {
+    nk_gamepad_stub_calls.raylib_is_gamepad_available++;
+    return nk_gamepad_stub_device(gamepad) != NULL;
+}
+
+bool IsGamepadButtonDown(int gamepad, int button) {
+    nk_gamepad_stub_calls.raylib_is_gamepad_button_down++;
+    return nk_gamepad_stub_button(nk_gamepad_stub_device(gamepad), nk_gamepad_stub_raylib_map, GAMEPAD_BUTTON_RIGHT_THUMB + 1, button);
+}
+
+const char* GetGamepadName(int gamepad) {
+    nk_gamepad_stub_calls.raylib_get_gamepad_name++;
+    return nk_gamepad_stub_name(nk_gamepad_stub_device(gamepad));
+}
+
+unsigned int TextLength(const char* text) {
+    nk_gamepad_stub_calls.raylib_text_length++;
+    return text != NULL ? (unsigned int)strlen(text) : 0;
+}
+
+// pntr_app
+
+static const int nk_gamepad_stub_pntr_map[PNTR_APP_GAMEPAD_BUTTON_RIGHT_THUMB + 1] = {
+    -1, // UNKNOWN
+    NK_GAMEPAD_BUTTON_UP,
+    NK_GAMEPAD_BUTTON_RIGHT,
+    NK_GAMEPAD_BUTTON_DOWN,
+    NK_GAMEPAD_BUTTON_LEFT,
+    NK_GAMEPAD_BUTTON_Y,
+    NK_GAMEPAD_BUTTON_B,
+    NK_GAMEPAD_BUTTON_A,
+    NK_GAMEPAD_BUTTON_X,
+    NK_GAMEPAD_BUTTON_LB,
+    -1, // LEFT_TRIGGER
+    NK_GAMEPAD_BUTTON_RB,
+    -1, // RIGHT_TRIGGER
+    NK_GAMEPAD_BUTTON_BACK,
+    NK_GAMEPAD_BUTTON_GUIDE,
+    NK_GAMEPAD_BUTTON_START,
+    -1, // LEFT_THUMB
+    -1, // RIGHT_THUMB
+};
+
+bool pntr_app_gamepad_button_down(pntr_app* app, int gamepad, pntr_app_gamepad_button key) {
+    nk_gamepad_stub_calls.pntr_gamepad_button_down++;
+    if (app == NULL) {
+        return false;
+    }
+    return nk_gamepad_stub_button(nk_gamepad_stub_device(gamepad), nk_gamepad_stub_pntr_map, PNTR_APP_GAMEPAD_BUTTON_RIGHT_THUMB + 1, (int)key);
+}
@@ -0,0 +1,210 @@
+#ifndef NUKLEAR_GAMEPAD_STUBS_H__
+#define NUKLEAR_GAMEPAD_STUBS_H__
+
+/**
+ * Stand-ins for the parts of SDL, GLFW, raylib and pntr_app that the backends call, so nuklear_gamepad_sdl.h,
+ * nuklear_gamepad_glfw.h, nuklear_gamepad_raylib.h and nuklear_gamepad_pntr.h can be tested and benchmarked without
+ * any devices, display or the libraries themselves.
+ *
+ * Include this instead of the library headers, and link nuklear_gamepad_stubs.c. Devices are scripted through
+ * nk_gamepad_stub_devices, and every stubbed call is counted in nk_gamepad_stub_calls.
+ */
+
+#include <stdbool.h>
+
+#ifndef NK_GAMEPAD_STUB_DEVICES
+/**
+ * How many scripted devices there are, covering every backend's joystick index range.
+ */
+#define NK_GAMEPAD_STUB_DEVICES 16
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// SDL2
+typedef unsigned char Uint8;
+typedef int Sint32;
+typedef unsigned int Uint32;
+typedef enum { SDL_FALSE = 0, SDL_TRUE = 1 } SDL_bool;
+typedef struct SDL_GameController SDL_GameController;
+typedef enum {
+    SDL_CONTROLLER_BUTTON_INVALID = -1,
+    SDL_CONTROLLER_BUTTON_A,
+    SDL_CONTROLLER_BUTTON_B,
+    SDL_CONTROLLER_BUTTON_X,
+    SDL_CONTROLLER_BUTTON_Y,
+    SDL_CONTROLLER_BUTTON_BACK,
+    SDL_CONTROLLER_BUTTON_GUIDE,
+    SDL_CONTROLLER_BUTTON_START,
+    SDL_CONTROLLER_BUTTON_LEFTSTICK,
+    SDL_CONTROLLER_BUTTON_RIGHTSTICK,
+    SDL_CONTROLLER_BUTTON_LEFTSHOULDER,
+    SDL_CONTROLLER_BUTTON_RIGHTSHOULDER,
+    SDL_CONTROLLER_BUTTON_DPAD_UP,
+    SDL_CONTROLLER_BUTTON_DPAD_DOWN,
+    SDL_CONTROLLER_BUTTON_DPAD_LEFT,
+    SDL_CONTROLLER_BUTTON_DPAD_RIGHT,
+    SDL_CONTROLLER_BUTTON_MAX
+} SDL_GameControllerButton;
+enum {
+    SDL_CONTROLLERDEVICEADDED = 0x653,
+    SDL_CONTROLLERDEVICEREMOVED
+};
+typedef struct SDL_ControllerDeviceEvent {
+    Uint32 type;
+    Uint32 timestamp;
+    Sint32 which;
+} SDL_ControllerDeviceEvent;
+typedef union SDL_Event {
+    Uint32 type;
+    SDL_ControllerDeviceEvent cdevice;
+} SDL_Event;
+
+SDL_bool SDL_IsGameController(int joystick_index);
+SDL_GameController* SDL_GameControllerOpen(int joystick_index);
+void SDL_GameControllerClose(SDL_GameController* gamecontroller);
+Uint8 SDL_GameControllerGetButton(SDL_GameController* gamecontroller, SDL_GameControllerButton button);
+const char* SDL_GameControllerName(SDL_GameController* gamecontroller);
+
+// GLFW
+#define GLFW_TRUE 1
+#define GLFW_FALSE 0
+#define GLFW_JOYSTICK_LAST 15
+#define GLFW_GAMEPAD_BUTTON_A 0
+#define GLFW_GAMEPAD_BUTTON_B 1
+#define GLFW_GAMEPAD_BUTTON_X 2
+#define GLFW_GAMEPAD_BUTTON_Y 3
+#define GLFW_GAMEPAD_BUTTON_LEFT_BUMPER 4
+#define GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER 5
+#define GLFW_GAMEPAD_BUTTON_BACK 6
+#define GLFW_GAMEPAD_BUTTON_START 7
+#define GLFW_GAMEPAD_BUTTON_GUIDE 8
+#define GLFW_GAMEPAD_BUTTON_LEFT_THUMB 9
+#define GLFW_GAMEPAD_BUTTON_RIGHT_THUMB 10
+#define GLFW_GAMEPAD_BUTTON_DPAD_UP 11
+#define GLFW_GAMEPAD_BUTTON_DPAD_RIGHT 12
+#define GLFW_GAMEPAD_BUTTON_DPAD_DOWN 13
+#define GLFW_GAMEPAD_BUTTON_DPAD_LEFT 14
+#define GLFW_GAMEPAD_BUTTON_LAST GLFW_GAMEPAD_BUTTON_DPAD_LEFT
+typedef struct GLFWgamepadstate {
+    unsigned char buttons[15];
+    float axes[6];
+} GLFWgamepadstate;
+
+int glfwJoystickPresent(int jid);
+int glfwJoystickIsGamepad(int jid);
+int glfwGetGamepadState(int jid, GLFWgamepadstate* state);
+const char* glfwGetGamepadName(int jid);
+
+// raylib
+typedef enum {
+    GAMEPAD_BUTTON_UNKNOWN = 0,
+    GAMEPAD_BUTTON_LEFT_FACE_UP,
+    GAMEPAD_BUTTON_LEFT_FACE_RIGHT,
+    GAMEPAD_BUTTON_LEFT_FACE_DOWN,
+    GAMEPAD_BUTTON_LEFT_FACE_LEFT,
+    GAMEPAD_BUTTON_RIGHT_FACE_UP,
+    GAMEPAD_BUTTON_RIGHT_FACE_RIGHT,
+    GAMEPAD_BUTTON_RIGHT_FACE_DOWN,
+    GAMEPAD_BUTTON_RIGHT_FACE_LEFT,
+    GAMEPAD_BUTTON_LEFT_TRIGGER_1,
+    GAMEPAD_BUTTON_LEFT_TRIGGER_2,
+    GAMEPAD_BUTTON_RIGHT_TRIGGER_1,
+    GAMEPAD_BUTTON_RIGHT_TRIGGER_2,
+    GAMEPAD_BUTTON_MIDDLE_LEFT,
+    GAMEPAD_BUTTON_MIDDLE,
+    GAMEPAD_BUTTON_MIDDLE_RIGHT,
+    GAMEPAD_BUTTON_LEFT_THUMB,
+    GAMEPAD_BUTTON_RIGHT_THUMB
+} GamepadButton;
+
+bool IsGamepadAvailable(int gamepad);
+bool IsGamepadButtonDown(int gamepad, int button);
+const char* GetGamepadName(int gamepad);
+unsigned int TextLength(const char* text);
+
+// pntr_app
+#define PNTR_APP_MAX_GAMEPADS 4
+typedef struct pntr_app pntr_app;
+typedef enum pntr_app_gamepad_button {
+    PNTR_APP_GAMEPAD_BUTTON_UNKNOWN = 0,
+    PNTR_APP_GAMEPAD_BUTTON_UP,
+    PNTR_APP_GAMEPAD_BUTTON_RIGHT,
+    PNTR_APP_GAMEPAD_BUTTON_DOWN,
+    PNTR_APP_GAMEPAD_BUTTON_LEFT,
+    PNTR_APP_GAMEPAD_BUTTON_Y,
+    PNTR_APP_GAMEPAD_BUTTON_B,
+    PNTR_APP_GAMEPAD_BUTTON_A,
+    PNTR_APP_GAMEPAD_BUTTON_X,
+    PNTR_APP_GAMEPAD_BUTTON_LEFT_SHOULDER,
+    PNTR_APP_GAMEPAD_BUTTON_LEFT_TRIGGER,
+    PNTR_APP_GAMEPAD_BUTTON_RIGHT_SHOULDER,
+    PNTR_APP_GAMEPAD_BUTTON_RIGHT_TRIGGER,
+    PNTR_APP_GAMEPAD_BUTTON_SELECT,
+    PNTR_APP_GAMEPAD_BUTTON_MENU,
+    PNTR_APP_GAMEPAD_BUTTON_START,
+    PNTR_APP_GAMEPAD_BUTTON_LEFT_THUMB,
+    PNTR_APP_GAMEPAD_BUTTON_RIGHT_THUMB
+} pntr_app_gamepad_button;
+
+bool pntr_app_gamepad_button_down(pntr_app* app, int gamepad, pntr_app_gamepad_button key);
+
+/**
+ * A scripted device, shared by all of the stubbed libraries at the same joystick index.
+ */
+struct nk_gamepad_stub_device {
+    bool connected;
+    unsigned int buttons; /** Held buttons, as NK_GAMEPAD_BUTTON_FLAG() flags. */
+    const char* name; /** NULL reports an empty name. */
+};
+
+/**
+ * How many times each stubbed function was called.
+ */
+struct nk_gamepad_stub_calls {
+    unsigned long sdl_is_game_controller;
+    unsigned long sdl_open;
+    unsigned long sdl_close;
+    unsigned long sdl_get_button;
+    unsigned long sdl_name;
+    unsigned long glfw_joystick_present;
+    unsigned long glfw_joystick_is_gamepad;
+    unsigned long glfw_get_gamepad_state;
+    unsigned long glfw_get_gamepad_name;
+    unsigned long raylib_is_gamepad_available;
+    unsigned long raylib_is_gamepad_button_down;
+    unsigned long raylib_get_gamepad_name;
+    unsigned long raylib_text_length;
+    unsigned long pntr_gamepad_button_down;
+};
+
+extern struct nk_gamepad_stub_device nk_gamepad_stub_devices[NK_GAMEPAD_STUB_DEVICES];
+extern struct nk_gamepad_stub_calls nk_gamepad_stub_calls;
+
+/**
+ * Disconnect every scripted device and clear the call counters.
+ */
+void nk_gamepad_stub_reset(void);
+
+/**
+ * Clear the call counters, keeping the scripted devices.
+ */
+void nk_gamepad_stub_reset_calls(void);
+
+/**
+ * The total amount of stubbed calls since the counters were last cleared.
+ */
+unsigned long nk_gamepad_stub_total_calls(void);
+
+/**
+ * A pntr_app pointer to hand to nk_gamepad_pntr_input_soure(), since the pntr backend needs a non-NULL app.
+ */
+pntr_app* nk_gamepad_stub_pntr_app(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif